@@ -0,0 +1,234 @@
+"""Benchmark and regression-tracking suite for the FlarePie engines.
+
+Times the core engine entry points across a matrix of time steps, burn
+durations and stage counts, records steps/second and peak RSS into a JSON
+history file, and can diff two recorded runs to flag regressions.
+
+Usage:
+    python bench/benchmark.py run [--history bench/history.json] [--label NAME]
+    python bench/benchmark.py diff BASELINE_LABEL CANDIDATE_LABEL
+    python bench/benchmark.py list
+"""
+
+import argparse
+import json
+import os
+import platform
+import resource
+import sys
+import time
+from datetime import datetime
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
+
+REGRESSION_THRESHOLD = 0.05
+DEFAULT_HISTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "history.json")
+
+BASE_CASE = {
+    "fuel_type": "RP1",
+    "cocp": 7000000,
+    "ct": 3500,
+    "altitude": 0,
+    "intmass": 10000,
+    "mfr": 250,
+    "reference_area": 1.0,
+}
+
+
+def _peak_rss_mb():
+    rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is KB on Linux, bytes on macOS
+    if platform.system() == "Darwin":
+        rss /= 1024
+    return rss / 1024
+
+
+def _timed(fn, *args, **kwargs):
+    start = time.perf_counter()
+    result = fn(*args, **kwargs)
+    return result, time.perf_counter() - start
+
+
+def bench_rocket_simulation():
+    from Engine import rocket_simulation, rocket_simulation_vectorized
+
+    records = {}
+    for dt in (0.1, 0.01):
+        for burn_seconds in (30, 120):
+            propmass = BASE_CASE["mfr"] * burn_seconds
+            case = dict(BASE_CASE, propmass=propmass, dt=dt)
+            for name, fn in (("scalar", rocket_simulation),
+                             ("vectorized", rocket_simulation_vectorized)):
+                result, elapsed = _timed(fn, **case)
+                steps = len(result.get("time", []))
+                records[f"rocket_simulation.{name}.dt{dt}.burn{burn_seconds}s"] = {
+                    "seconds": elapsed,
+                    "steps": steps,
+                    "steps_per_second": steps / elapsed if elapsed > 0 else 0.0,
+                }
+    return records
+
+
+def bench_multi_stage():
+    from advanced_engine import AdvancedRocketEngine, Stage
+
+    records = {}
+    for stage_count in (2, 4):
+        engine = AdvancedRocketEngine()
+        for i in range(stage_count):
+            scale = 0.5 ** i
+            engine.add_stage(Stage(
+                name=f"Stage {i + 1}",
+                fuel_type="RP1",
+                chamber_pressure=7000000,
+                combustion_temp=3500,
+                total_mass=10000 * scale,
+                propellant_mass=8000 * scale,
+                mass_flow_rate=250 * scale,
+                reference_area=1.0 * scale,
+                separation_altitude=10000 * (i + 1),
+            ))
+        result, elapsed = _timed(engine.multi_stage_simulation, dt=0.05, max_time=600)
+        steps = len(result.get("time", []))
+        records[f"multi_stage_simulation.stages{stage_count}"] = {
+            "seconds": elapsed,
+            "steps": steps,
+            "steps_per_second": steps / elapsed if elapsed > 0 else 0.0,
+        }
+    return records
+
+
+def bench_nozzle_performance():
+    from Engine import nozzle_performance
+
+    iterations = 100000
+    start = time.perf_counter()
+    for _ in range(iterations):
+        nozzle_performance(250, 3000, 101325, 90000, 0.5)
+    elapsed = time.perf_counter() - start
+    return {
+        "nozzle_performance.x100k": {
+            "seconds": elapsed,
+            "steps": iterations,
+            "steps_per_second": iterations / elapsed if elapsed > 0 else 0.0,
+        }
+    }
+
+
+def bench_report_generation():
+    try:
+        from report_generator import ReportGenerator
+        from Engine import rocket_simulation
+    except ImportError as exc:
+        print(f"skipping report benchmark ({exc})")
+        return {}
+
+    case = dict(BASE_CASE, propmass=BASE_CASE["mfr"] * 60, dt=0.01)
+    data = rocket_simulation(**case)
+    generator = ReportGenerator()
+    output = os.path.join(os.path.dirname(DEFAULT_HISTORY), "_bench_report.pdf")
+    try:
+        _, elapsed = _timed(generator.generate_simulation_report, data, case, output)
+    finally:
+        if os.path.exists(output):
+            os.remove(output)
+    return {
+        "report_generation.burn60s": {
+            "seconds": elapsed,
+            "steps": len(data.get("time", [])),
+            "steps_per_second": 0.0,
+        }
+    }
+
+
+def run_benchmarks(label):
+    records = {}
+    records.update(bench_rocket_simulation())
+    records.update(bench_multi_stage())
+    records.update(bench_nozzle_performance())
+    records.update(bench_report_generation())
+
+    for name, record in sorted(records.items()):
+        print(f"{name:<55} {record['seconds']:>8.3f}s  {record['steps_per_second']:>12.0f} steps/s")
+
+    return {
+        "label": label,
+        "timestamp": datetime.now().isoformat(),
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "peak_rss_mb": _peak_rss_mb(),
+        "records": records,
+    }
+
+
+def load_history(path):
+    if os.path.exists(path):
+        with open(path, "r") as f:
+            return json.load(f)
+    return []
+
+
+def save_history(path, history):
+    directory = os.path.dirname(path)
+    if directory and not os.path.exists(directory):
+        os.makedirs(directory)
+    with open(path, "w") as f:
+        json.dump(history, f, indent=4)
+
+
+def find_run(history, label):
+    for run in reversed(history):
+        if run["label"] == label:
+            return run
+    return None
+
+
+def diff_runs(baseline, candidate):
+    regressions = []
+    for name, base in sorted(baseline["records"].items()):
+        cand = candidate["records"].get(name)
+        if cand is None:
+            continue
+        base_s, cand_s = base["seconds"], cand["seconds"]
+        change = (cand_s - base_s) / base_s if base_s > 0 else 0.0
+        marker = " <-- REGRESSION" if change > REGRESSION_THRESHOLD else ""
+        print(f"{name:<55} {base_s:>8.3f}s -> {cand_s:>8.3f}s  {change:>+7.1%}{marker}")
+        if change > REGRESSION_THRESHOLD:
+            regressions.append(name)
+    rss_change = candidate["peak_rss_mb"] - baseline["peak_rss_mb"]
+    print(f"\npeak RSS: {baseline['peak_rss_mb']:.1f} MB -> {candidate['peak_rss_mb']:.1f} MB ({rss_change:+.1f} MB)")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("command", choices=["run", "diff", "list"])
+    parser.add_argument("labels", nargs="*", help="baseline and candidate labels for diff")
+    parser.add_argument("--history", default=DEFAULT_HISTORY)
+    parser.add_argument("--label", default=None, help="label for this run (default: timestamp)")
+    args = parser.parse_args()
+
+    history = load_history(args.history)
+
+    if args.command == "run":
+        label = args.label or datetime.now().strftime("%Y%m%d_%H%M%S")
+        run = run_benchmarks(label)
+        history.append(run)
+        save_history(args.history, history)
+        print(f"\nrecorded run '{label}' in {args.history}")
+    elif args.command == "list":
+        for run in history:
+            print(f"{run['label']:<25} {run['timestamp']}  ({len(run['records'])} records)")
+    else:
+        if len(args.labels) != 2:
+            parser.error("diff requires BASELINE_LABEL and CANDIDATE_LABEL")
+        baseline = find_run(history, args.labels[0])
+        candidate = find_run(history, args.labels[1])
+        if baseline is None or candidate is None:
+            parser.error("label not found in history (use 'list' to see recorded runs)")
+        regressions = diff_runs(baseline, candidate)
+        sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,8 +1,18 @@
 import math
 import logging
+import time
 import numpy as np
 from datetime import datetime
 
+try:
+    from numba import njit
+    NUMBA_AVAILABLE = True
+except ImportError:
+    NUMBA_AVAILABLE = False
+
+from telemetry import get_telemetry
+from profiling import get_profiler
+
 logging.basicConfig(
     format="%(asctime)s - %(levelname)s - %(message)s",
     level=logging.INFO,
@@ -10,6 +20,61 @@ logging.basicConfig(
 )
 
 
+class AtmosphereTable:
+    """Dense altitude grid of pressure, density and speed of sound.
+
+    Built once (see get_atmosphere_table) so the per-step pow/exp/sqrt trio
+    in the integration loop becomes a linear interpolation into precomputed
+    arrays. Scalar lookups index the grid directly; the *_batch variants
+    serve whole arrays of altitudes at once.
+    """
+
+    def __init__(self, max_altitude=120000.0, resolution=10.0):
+        self.resolution = float(resolution)
+        self.altitudes = np.arange(0.0, max_altitude + resolution, resolution)
+        base = np.clip(1.0 - 2.25577e-5 * self.altitudes, 0.0, None)
+        self.pressures = 101325.0 * base ** 5.25588
+        self.densities = 1.225 * np.exp(-self.altitudes / 8500.0)
+        self.speeds_of_sound = 340.0 * np.sqrt(self.pressures / 101325.0)
+
+    def _interp(self, table, altitude):
+        pos = max(0.0, altitude) / self.resolution
+        idx = int(pos)
+        last = len(table) - 1
+        if idx >= last:
+            return float(table[last])
+        frac = pos - idx
+        return float(table[idx] * (1.0 - frac) + table[idx + 1] * frac)
+
+    def pressure(self, altitude):
+        return self._interp(self.pressures, altitude)
+
+    def density(self, altitude):
+        return self._interp(self.densities, altitude)
+
+    def speed_of_sound(self, altitude):
+        return self._interp(self.speeds_of_sound, altitude)
+
+    def pressure_batch(self, altitudes):
+        return np.interp(np.clip(altitudes, 0.0, None), self.altitudes, self.pressures)
+
+    def density_batch(self, altitudes):
+        return np.interp(np.clip(altitudes, 0.0, None), self.altitudes, self.densities)
+
+    def speed_of_sound_batch(self, altitudes):
+        return np.interp(np.clip(altitudes, 0.0, None), self.altitudes, self.speeds_of_sound)
+
+
+_atmosphere_table = None
+
+
+def get_atmosphere_table():
+    global _atmosphere_table
+    if _atmosphere_table is None:
+        _atmosphere_table = AtmosphereTable()
+    return _atmosphere_table
+
+
 def get_atmospheric_pressure(altitude):
     altitude = max(0, altitude)
     p0 = 101325.0
@@ -23,31 +88,13 @@ def get_atmospheric_pressure(altitude):
     return max(pressure, 0.0)
 
 
-def calculate_drag(velocity, altitude, reference_area=1.0):
-
-    p0 = 1.225
-    h0 = 8500
-    try:
-        if altitude > 1e6:
-            density = 0.0
-        else:
-            density = p0 * math.exp(-altitude / h0)
-    except OverflowError:
-        density = 0.0
-
-
-    speed_of_sound = 340.0 * math.sqrt(get_atmospheric_pressure(altitude) / 101325.0)
-    mach = abs(velocity) / max(speed_of_sound, 0.1)
-
-    if mach < 0.8:
-        cd = 0.3
-    elif mach < 1.1:
-        cd = 0.3 + (mach - 0.8) * 1.0
-    else:
-        cd = 0.6 - 0.1 * min(mach - 1.1, 0.4)
-
-    drag = 0.5 * density * velocity ** 2 * reference_area * cd
-    return drag if velocity > 0 else -drag
+def calculate_drag(velocity, altitude, reference_area=1.0, atmosphere=None):
+    # Kept as the historical entry point; the tables live in drag_model
+    # (imported lazily to avoid a circular import). The atmosphere
+    # argument is accepted for compatibility but the shared table is
+    # authoritative.
+    from drag_model import get_drag_model
+    return get_drag_model().drag(velocity, altitude, reference_area)
 
 
 def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
@@ -83,8 +130,17 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
     last_return_time = 0.0
     real_time_data_interval = 0.25
 
+    atmosphere = get_atmosphere_table()
+    telemetry = get_telemetry()
+
+    profiler = get_profiler()
+    loop_slot = profiler.section("engine.rocket_simulation.loop")
+    drag_slot = profiler.section("engine.rocket_simulation.drag")
+    telemetry_slot = profiler.section("engine.rocket_simulation.telemetry")
+    loop_started = time.perf_counter()
+
     while propmass > 0 and (max_time is None or time_elapsed < max_time):
-        ap = get_atmospheric_pressure(current_altitude)
+        ap = atmosphere.pressure(current_altitude)
         pressure_ratio = (ap / cocp) ** ((k - 1) / k) if cocp > 0 else 0.0
 
         ve = math.sqrt((2.0 * k) / (k - 1.0) * R * ct * (1.0 - pressure_ratio))
@@ -94,14 +150,18 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
         propmass -= mass_used
         current_mass -= mass_used
 
-        drag = calculate_drag(velocity, current_altitude, reference_area)
+        drag_started = time.perf_counter()
+        drag = calculate_drag(velocity, current_altitude, reference_area, atmosphere)
+        profiler.record(drag_slot, drag_started)
 
         acceleration = (thrust / current_mass) - 9.81 - (drag / current_mass)
 
         velocity_mid = velocity + 0.5 * acceleration * dt
         altitude_mid = current_altitude + 0.5 * velocity * dt
 
-        drag_mid = calculate_drag(velocity_mid, altitude_mid, reference_area)
+        drag_started = time.perf_counter()
+        drag_mid = calculate_drag(velocity_mid, altitude_mid, reference_area, atmosphere)
+        profiler.record(drag_slot, drag_started)
 
         acceleration_mid = (thrust / current_mass) - 9.81 - (drag_mid / current_mass)
 
@@ -127,11 +187,9 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
         drag_values.append(drag)
         acceleration_values.append(acceleration)
 
-        if int(time_elapsed) % 5 == 0 or time_elapsed < 1.0:
-            logging.info(
-                f"t={time_elapsed:.2f}s | Thrust={thrust:.2f} N | Velocity={velocity:.2f} m/s | "
-                f"Altitude={current_altitude:.2f} m | ΔV={delta_v_step:.2f} m/s | Drag={drag:.2f} N"
-            )
+        telemetry_started = time.perf_counter()
+        telemetry.record(time_elapsed, thrust, velocity, current_altitude, drag)
+        profiler.record(telemetry_slot, telemetry_started)
 
         velocity = velocity_new
         current_altitude = altitude_new
@@ -139,6 +197,7 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
 
         if real_time_mode and time_elapsed - last_return_time >= real_time_data_interval:
             last_return_time = time_elapsed
+            profiler.record(loop_slot, loop_started)
             return {
                 "time": time_steps,
                 "thrust": thrust_values,
@@ -156,6 +215,7 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
                 "simulation_complete": False
             }
 
+    profiler.record(loop_slot, loop_started)
     logging.info("Simulation complete.")
 
     return {
@@ -176,30 +236,736 @@ def rocket_simulation(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
     }
 
 
+def _integration_loop(n_steps, mass_values, thrust_values, velocity_values, altitude_values,
+                      drag_values, acceleration_values, k, R, ct, cocp, mfr, dt,
+                      reference_area, initial_altitude,
+                      atm_pressures, atm_densities, atm_sos, atm_resolution):
+    """Hot inner loop shared by the vectorized engine.
+
+    Self-contained scalar math (atmosphere table lookup, drag and midpoint
+    integrator inlined) so it can be compiled as-is by Numba when
+    performance.jit_enabled is set. Atmosphere state comes from the
+    precomputed AtmosphereTable grids via linear interpolation instead of
+    per-step pow/exp/sqrt. Fills the preallocated output arrays and returns
+    the final state.
+    """
+    velocity = 0.0
+    current_altitude = initial_altitude
+    last = atm_pressures.shape[0] - 1
+
+    for i in range(n_steps):
+        current_mass = mass_values[i]
+
+        # Atmosphere lookup at the step point
+        alt = max(0.0, current_altitude)
+        pos = alt / atm_resolution
+        idx = int(pos)
+        if idx >= last:
+            ap = atm_pressures[last]
+            density = atm_densities[last]
+            speed_of_sound = atm_sos[last]
+        else:
+            frac = pos - idx
+            ap = atm_pressures[idx] * (1.0 - frac) + atm_pressures[idx + 1] * frac
+            density = atm_densities[idx] * (1.0 - frac) + atm_densities[idx + 1] * frac
+            speed_of_sound = atm_sos[idx] * (1.0 - frac) + atm_sos[idx + 1] * frac
+
+        pressure_ratio = (ap / cocp) ** ((k - 1.0) / k) if cocp > 0 else 0.0
+        ve = math.sqrt((2.0 * k) / (k - 1.0) * R * ct * (1.0 - pressure_ratio))
+        thrust = mfr * ve
+
+        mach = abs(velocity) / max(speed_of_sound, 0.1)
+        if mach < 0.8:
+            cd = 0.3
+        elif mach < 1.1:
+            cd = 0.3 + (mach - 0.8) * 1.0
+        else:
+            cd = 0.6 - 0.1 * min(mach - 1.1, 0.4)
+        drag = 0.5 * density * velocity ** 2 * reference_area * cd
+        if velocity <= 0:
+            drag = -drag
+
+        acceleration = (thrust / current_mass) - 9.81 - (drag / current_mass)
+
+        velocity_mid = velocity + 0.5 * acceleration * dt
+        altitude_mid = current_altitude + 0.5 * velocity * dt
+
+        # Atmosphere lookup and drag at the midpoint
+        alt_mid = max(0.0, altitude_mid)
+        pos_mid = alt_mid / atm_resolution
+        idx_mid = int(pos_mid)
+        if idx_mid >= last:
+            density_mid = atm_densities[last]
+            sos_mid = atm_sos[last]
+        else:
+            frac_mid = pos_mid - idx_mid
+            density_mid = atm_densities[idx_mid] * (1.0 - frac_mid) + atm_densities[idx_mid + 1] * frac_mid
+            sos_mid = atm_sos[idx_mid] * (1.0 - frac_mid) + atm_sos[idx_mid + 1] * frac_mid
+        mach_mid = abs(velocity_mid) / max(sos_mid, 0.1)
+        if mach_mid < 0.8:
+            cd_mid = 0.3
+        elif mach_mid < 1.1:
+            cd_mid = 0.3 + (mach_mid - 0.8) * 1.0
+        else:
+            cd_mid = 0.6 - 0.1 * min(mach_mid - 1.1, 0.4)
+        drag_mid = 0.5 * density_mid * velocity_mid ** 2 * reference_area * cd_mid
+        if velocity_mid <= 0:
+            drag_mid = -drag_mid
+
+        acceleration_mid = (thrust / current_mass) - 9.81 - (drag_mid / current_mass)
+
+        thrust_values[i] = thrust
+        velocity_values[i] = velocity
+        altitude_values[i] = current_altitude
+        drag_values[i] = drag
+        acceleration_values[i] = acceleration
+
+        velocity = velocity + acceleration_mid * dt
+        current_altitude = current_altitude + velocity_mid * dt
+
+    return velocity, current_altitude
+
+
+_integration_loop_jit = None
+
+
+def _select_integration_loop():
+    if not NUMBA_AVAILABLE:
+        return _integration_loop
+    try:
+        from config import config
+        jit_enabled = bool(config.get("performance.jit_enabled", True))
+    except Exception:
+        jit_enabled = True
+    if not jit_enabled:
+        return _integration_loop
+    global _integration_loop_jit
+    if _integration_loop_jit is None:
+        _integration_loop_jit = njit(cache=True)(_integration_loop)
+    return _integration_loop_jit
+
+
+def rocket_simulation_vectorized(fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
+                                 reference_area=1.0, max_time=None):
+    """Array-backed variant of rocket_simulation.
+
+    Preallocates NumPy float64 arrays sized from the burn duration instead of
+    growing eleven Python lists, and computes the mass depletion, energy, isp
+    and delta-v series as array kernels. The velocity/altitude integration is
+    inherently sequential so it stays a scalar loop writing into the arrays.
+    Returns the same result dict as rocket_simulation, backed by arrays.
+    """
+    fuel_properties = {
+        "RP1": (1.2, 287.0),
+        "LH2": (1.4, 4124.0),
+        "SRF": (1.2, 191.0),
+        "N2O4": (1.26, 320.0)
+    }
+
+    if fuel_type not in fuel_properties:
+        return {"error": "Invalid fuel type"}
+
+    k, R = fuel_properties[fuel_type]
+
+    if mfr <= 0 or dt <= 0:
+        return {"error": "Mass flow rate and time step must be positive"}
+
+    n_steps = int(math.ceil(propmass / (mfr * dt)))
+    if max_time is not None:
+        n_steps = min(n_steps, int(math.ceil(max_time / dt)))
+    n_steps = max(n_steps, 0)
+
+    # Mass depletion is independent of the trajectory, so the fuel and mass
+    # series are computed up front with a cumulative sum.
+    mass_used = np.full(n_steps, mfr * dt)
+    cumulative = np.cumsum(mass_used)
+    overshoot = cumulative > propmass
+    if overshoot.any():
+        first = int(np.argmax(overshoot))
+        mass_used[first] = propmass - (cumulative[first - 1] if first > 0 else 0.0)
+        mass_used[first + 1:] = 0.0
+        cumulative = np.cumsum(mass_used)
+
+    fuel_remaining = propmass - cumulative
+    mass_values = intmass - cumulative
+
+    time_steps = np.arange(n_steps) * dt
+    thrust_values = np.empty(n_steps)
+    velocity_values = np.empty(n_steps)
+    altitude_values = np.empty(n_steps)
+    drag_values = np.empty(n_steps)
+    acceleration_values = np.empty(n_steps)
+
+    logging.info(f"Starting vectorized simulation: Fuel={fuel_type}, Initial Mass={intmass} kg, Propellant={propmass} kg")
+
+    atmosphere = get_atmosphere_table()
+    loop = _select_integration_loop()
+    velocity, current_altitude = loop(
+        n_steps, mass_values, thrust_values, velocity_values, altitude_values,
+        drag_values, acceleration_values, k, R, ct, cocp, mfr, dt,
+        reference_area, float(altitude),
+        atmosphere.pressures, atmosphere.densities, atmosphere.speeds_of_sound,
+        atmosphere.resolution
+    )
+
+    # Derived series as array kernels over the stored state.
+    energy_values = 0.5 * mass_values * velocity_values ** 2 + mass_values * 9.81 * altitude_values
+    isp_values = thrust_values / (mfr * 9.81)
+    mass_flow_values = np.full(n_steps, mfr)
+
+    velocity_steps = np.diff(velocity_values, append=velocity)
+    delta_v = float(np.sum(np.clip(velocity_steps, 0.0, None)))
+
+    logging.info("Vectorized simulation complete.")
+
+    return {
+        "time": time_steps,
+        "thrust": thrust_values,
+        "fuel_remaining": fuel_remaining,
+        "mass_flow": mass_flow_values,
+        "velocity": velocity_values,
+        "altitude": altitude_values,
+        "isp_values": isp_values,
+        "energy": energy_values,
+        "drag": drag_values,
+        "acceleration": acceleration_values,
+        "final_time": n_steps * dt,
+        "initial_thrust": float(thrust_values[0]) if n_steps > 0 else 0,
+        "delta_v": delta_v,
+        "simulation_complete": True
+    }
+
+
+class RocketSimulationStream:
+    """Resumable stepper over the rocket_simulation physics.
+
+    Holds the flight state (mass, velocity, altitude, propellant) between
+    polls, so a live display advances incrementally instead of re-running
+    the whole flight each frame the way real_time_mode=True does. poll()
+    integrates up to sim_seconds further and returns only the samples
+    produced since the last call; result() returns the full accumulated
+    series in the rocket_simulation dict shape.
+    """
+
+    def __init__(self, fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
+                 reference_area=1.0, max_time=None):
+        fuel_properties = {
+            "RP1": (1.2, 287.0),
+            "LH2": (1.4, 4124.0),
+            "SRF": (1.2, 191.0),
+            "N2O4": (1.26, 320.0)
+        }
+        if fuel_type not in fuel_properties:
+            raise ValueError(f"Invalid fuel type: {fuel_type}")
+
+        self.k, self.R = fuel_properties[fuel_type]
+        self.cocp = cocp
+        self.ct = ct
+        self.mfr = mfr
+        self.dt = dt
+        self.reference_area = reference_area
+        self.max_time = max_time
+
+        self.current_mass = intmass
+        self.propmass = propmass
+        self.velocity = 0.0
+        self.current_altitude = altitude
+        self.time_elapsed = 0.0
+        self.delta_v = 0.0
+        self.complete = False
+
+        self.atmosphere = get_atmosphere_table()
+        self.history = {name: [] for name in (
+            "time", "thrust", "fuel_remaining", "mass_flow", "velocity",
+            "altitude", "isp_values", "energy", "drag", "acceleration")}
+
+    def _step(self):
+        ap = self.atmosphere.pressure(self.current_altitude)
+        k, R = self.k, self.R
+        pressure_ratio = (ap / self.cocp) ** ((k - 1) / k) if self.cocp > 0 else 0.0
+        ve = math.sqrt((2.0 * k) / (k - 1.0) * R * self.ct * (1.0 - pressure_ratio))
+        thrust = self.mfr * ve
+
+        mass_used = min(self.mfr * self.dt, self.propmass)
+        self.propmass -= mass_used
+        self.current_mass -= mass_used
+
+        velocity_new, altitude_new, drag, acceleration = _midpoint_step(
+            self.velocity, self.current_altitude, thrust, self.current_mass,
+            self.reference_area, self.dt, self.atmosphere)
+
+        isp = thrust / (self.mfr * 9.81) if self.mfr > 0 else 0.0
+        energy = (0.5 * self.current_mass * self.velocity ** 2
+                  + self.current_mass * 9.81 * self.current_altitude)
+
+        h = self.history
+        h["time"].append(self.time_elapsed)
+        h["thrust"].append(thrust)
+        h["fuel_remaining"].append(self.propmass)
+        h["mass_flow"].append(self.mfr)
+        h["velocity"].append(self.velocity)
+        h["altitude"].append(self.current_altitude)
+        h["isp_values"].append(isp)
+        h["energy"].append(energy)
+        h["drag"].append(drag)
+        h["acceleration"].append(acceleration)
+
+        self.delta_v += max(0.0, velocity_new - self.velocity)
+        self.velocity = velocity_new
+        self.current_altitude = altitude_new
+        self.time_elapsed += self.dt
+
+    def poll(self, sim_seconds=0.25):
+        """Advance up to sim_seconds of flight and return the new samples."""
+        start = len(self.history["time"])
+        target = self.time_elapsed + sim_seconds
+
+        while (not self.complete and self.time_elapsed < target):
+            if self.propmass <= 0 or (self.max_time is not None and self.time_elapsed >= self.max_time):
+                self.complete = True
+                break
+            self._step()
+
+        samples = {name: series[start:] for name, series in self.history.items()}
+        samples["simulation_complete"] = self.complete
+        return samples
+
+    def result(self):
+        out = {name: series for name, series in self.history.items()}
+        out["final_time"] = self.time_elapsed
+        out["initial_thrust"] = self.history["thrust"][0] if self.history["thrust"] else 0
+        out["delta_v"] = self.delta_v
+        out["simulation_complete"] = self.complete
+        return out
+
+
+def _midpoint_step(velocity, altitude, thrust, mass, reference_area, dt, atmosphere=None):
+    drag = calculate_drag(velocity, altitude, reference_area, atmosphere)
+    acceleration = (thrust / mass) - 9.81 - (drag / mass)
+
+    velocity_mid = velocity + 0.5 * acceleration * dt
+    altitude_mid = altitude + 0.5 * velocity * dt
+
+    drag_mid = calculate_drag(velocity_mid, altitude_mid, reference_area, atmosphere)
+    acceleration_mid = (thrust / mass) - 9.81 - (drag_mid / mass)
+
+    velocity_new = velocity + acceleration_mid * dt
+    altitude_new = altitude + velocity_mid * dt
+    return velocity_new, altitude_new, drag, acceleration
+
+
+def rocket_simulation_adaptive(fuel_type, cocp, ct, altitude, intmass, propmass, mfr,
+                               output_dt=0.1, tolerance=1e-3, min_dt=1e-4, max_dt=1.0,
+                               reference_area=1.0, max_time=None):
+    """Error-controlled adaptive-step variant of rocket_simulation.
+
+    Each step is taken twice — once at dt and once as two half steps — and
+    the difference drives the step-size controller: steps are rejected and
+    retried smaller when the velocity/altitude error exceeds tolerance, and
+    grown (bounded by max_dt) when the flight is smooth. Output is sampled
+    on a fixed output_dt grid so the returned series match the fixed-step
+    engine's shape regardless of the internal step sizes used.
+    """
+    fuel_properties = {
+        "RP1": (1.2, 287.0),
+        "LH2": (1.4, 4124.0),
+        "SRF": (1.2, 191.0),
+        "N2O4": (1.26, 320.0)
+    }
+
+    if fuel_type not in fuel_properties:
+        return {"error": "Invalid fuel type"}
+
+    k, R = fuel_properties[fuel_type]
+
+    current_mass = intmass
+    time_elapsed = 0.0
+    velocity = 0.0
+    current_altitude = altitude
+    delta_v = 0.0
+    dt = min(output_dt, max_dt)
+    next_sample = 0.0
+
+    time_steps, thrust_values, fuel_remaining, mass_flow_values = [], [], [], []
+    velocity_values, altitude_values, isp_values = [], [], []
+    energy_values, drag_values, acceleration_values = [], [], []
+
+    logging.info(f"Starting adaptive simulation: Fuel={fuel_type}, Initial Mass={intmass} kg, Propellant={propmass} kg")
+
+    atmosphere = get_atmosphere_table()
+
+    while propmass > 0 and (max_time is None or time_elapsed < max_time):
+        ap = atmosphere.pressure(current_altitude)
+        pressure_ratio = (ap / cocp) ** ((k - 1) / k) if cocp > 0 else 0.0
+        ve = math.sqrt((2.0 * k) / (k - 1.0) * R * ct * (1.0 - pressure_ratio))
+        thrust = mfr * ve
+
+        # Step doubling: one full step vs two half steps, retried smaller on
+        # failure, grown when the local error leaves headroom.
+        while True:
+            v_full, h_full, drag, acceleration = _midpoint_step(
+                velocity, current_altitude, thrust, current_mass, reference_area, dt, atmosphere)
+            v_half, h_half, _, _ = _midpoint_step(
+                velocity, current_altitude, thrust, current_mass, reference_area, dt * 0.5, atmosphere)
+            v_two, h_two, _, _ = _midpoint_step(
+                v_half, h_half, thrust, current_mass, reference_area, dt * 0.5, atmosphere)
+
+            error = abs(v_full - v_two) + abs(h_full - h_two) / max(abs(h_two), 1.0)
+            if error <= tolerance or dt <= min_dt:
+                break
+            dt = max(dt * 0.5, min_dt)
+
+        if time_elapsed >= next_sample:
+            isp = thrust / (mfr * 9.81) if mfr > 0 else 0.0
+            time_steps.append(time_elapsed)
+            thrust_values.append(thrust)
+            fuel_remaining.append(propmass)
+            mass_flow_values.append(mfr)
+            velocity_values.append(velocity)
+            altitude_values.append(current_altitude)
+            isp_values.append(isp)
+            energy_values.append(0.5 * current_mass * velocity ** 2 + current_mass * 9.81 * current_altitude)
+            drag_values.append(drag)
+            acceleration_values.append(acceleration)
+            next_sample += output_dt
+
+        mass_used = min(mfr * dt, propmass)
+        propmass -= mass_used
+        current_mass -= mass_used
+
+        delta_v += max(0.0, v_two - velocity)
+        velocity = v_two
+        current_altitude = h_two
+        time_elapsed += dt
+
+        if error > 0:
+            dt = min(max(dt * min(0.9 * (tolerance / error) ** (1.0 / 3.0), 5.0), min_dt), max_dt)
+        else:
+            dt = max_dt
+
+    logging.info("Adaptive simulation complete.")
+
+    return {
+        "time": time_steps,
+        "thrust": thrust_values,
+        "fuel_remaining": fuel_remaining,
+        "mass_flow": mass_flow_values,
+        "velocity": velocity_values,
+        "altitude": altitude_values,
+        "isp_values": isp_values,
+        "energy": energy_values,
+        "drag": drag_values,
+        "acceleration": acceleration_values,
+        "final_time": time_elapsed,
+        "initial_thrust": thrust_values[0] if thrust_values else 0,
+        "delta_v": delta_v,
+        "simulation_complete": True
+    }
+
+
+BATCH_SUMMARY_CHANNELS = ("max_altitude", "max_velocity", "delta_v", "final_time", "max_thrust", "steps")
+
+
+def _summarize_result(result):
+    if "error" in result:
+        return [float("nan")] * len(BATCH_SUMMARY_CHANNELS)
+    altitude = result["altitude"]
+    velocity = result["velocity"]
+    thrust = result["thrust"]
+    return [
+        float(np.max(altitude)) if len(altitude) else 0.0,
+        float(np.max(velocity)) if len(velocity) else 0.0,
+        float(result["delta_v"]),
+        float(result["final_time"]),
+        float(np.max(thrust)) if len(thrust) else 0.0,
+        float(len(altitude))
+    ]
+
+
+def _batch_worker(args):
+    index, case, shm_name, shape = args
+    from multiprocessing import shared_memory
+    result = rocket_simulation_vectorized(**case)
+    summary = _summarize_result(result)
+    shm = shared_memory.SharedMemory(name=shm_name)
+    summaries = np.ndarray(shape, dtype=np.float64, buffer=shm.buf)
+    try:
+        summaries[index, :] = summary
+    finally:
+        # The ndarray view exports shm.buf; drop it before close() or
+        # close() raises BufferError while the export is still alive.
+        del summaries
+        shm.close()
+    return index
+
+
+def batch_simulate(configs, progress_callback=None, processes=None):
+    """Run a parameter sweep of rocket_simulation_vectorized cases.
+
+    Each entry in configs is a dict of rocket_simulation keyword arguments.
+    When performance.multiprocessing_enabled is set, cases fan out across a
+    process pool and per-case summaries are written into a shared-memory
+    array so the full per-step result dicts are never pickled back.
+    progress_callback(done, total) is invoked as cases complete.
+
+    Returns a dict mapping each BATCH_SUMMARY_CHANNELS name to a float64
+    array of length len(configs), plus the original case list under "cases".
+    """
+    n_cases = len(configs)
+    shape = (max(n_cases, 1), len(BATCH_SUMMARY_CHANNELS))
+
+    try:
+        from config import config as app_config
+        use_pool = bool(app_config.get("performance.multiprocessing_enabled", True))
+        backend_name = app_config.get("performance.array_backend", "numpy")
+    except Exception:
+        use_pool = True
+        backend_name = "numpy"
+
+    if backend_name != "numpy":
+        # A device backend advances all cases per step as N-wide array ops
+        # instead of fanning whole cases out across processes.
+        return batch_simulate_arrays(configs, backend=backend_name,
+                                     progress_callback=progress_callback)
+
+    if use_pool and n_cases > 1:
+        import multiprocessing
+        from multiprocessing import shared_memory
+
+        shm = shared_memory.SharedMemory(create=True, size=8 * shape[0] * shape[1])
+        try:
+            tasks = [(i, case, shm.name, shape) for i, case in enumerate(configs)]
+            with multiprocessing.Pool(processes) as pool:
+                for done, _ in enumerate(pool.imap_unordered(_batch_worker, tasks), 1):
+                    if progress_callback:
+                        progress_callback(done, n_cases)
+            summaries = np.ndarray(shape, dtype=np.float64, buffer=shm.buf).copy()
+        finally:
+            shm.close()
+            shm.unlink()
+    else:
+        summaries = np.empty(shape)
+        for i, case in enumerate(configs):
+            summaries[i, :] = _summarize_result(rocket_simulation_vectorized(**case))
+            if progress_callback:
+                progress_callback(i + 1, n_cases)
+
+    results = {name: summaries[:n_cases, j] for j, name in enumerate(BATCH_SUMMARY_CHANNELS)}
+    results["cases"] = configs
+    return results
+
+
+def batch_simulate_arrays(configs, backend=None, decimate_to=0, progress_callback=None):
+    """Advance every case of a sweep together as N-wide array steps.
+
+    The thrust/atmosphere/drag/midpoint math of the scalar kernel is
+    expressed against a pluggable array namespace (NumPy by default,
+    CuPy when performance.array_backend selects it), so each time step
+    updates all N cases at once and a GPU can run the whole dispersion
+    study on device. Only the summary channels — and, when decimate_to
+    is set, altitude/velocity trajectories decimated to that many
+    columns — are copied back to host memory.
+    """
+    from array_backend import get_array_module, to_numpy
+    xp = get_array_module(backend)
+
+    fuel_properties = {
+        "RP1": (1.2, 287.0),
+        "LH2": (1.4, 4124.0),
+        "SRF": (1.2, 191.0),
+        "N2O4": (1.26, 320.0)
+    }
+
+    n = len(configs)
+    nan = float("nan")
+
+    def column(name, default=None):
+        return np.array([float(c.get(name, default)) for c in configs])
+
+    k_host = np.array([fuel_properties.get(c.get("fuel_type"), (nan, nan))[0] for c in configs])
+    R_host = np.array([fuel_properties.get(c.get("fuel_type"), (nan, nan))[1] for c in configs])
+    cocp = xp.asarray(column("cocp"))
+    ct = xp.asarray(column("ct"))
+    mfr_host = column("mfr")
+    dt_host = column("dt")
+    propmass_host = column("propmass")
+    intmass = xp.asarray(column("intmass"))
+    area = xp.asarray(column("reference_area", 1.0))
+    k = xp.asarray(k_host)
+    R = xp.asarray(R_host)
+    mfr = xp.asarray(mfr_host)
+    dt = xp.asarray(dt_host)
+
+    with np.errstate(divide="ignore", invalid="ignore"):
+        n_steps_host = np.where(mfr_host * dt_host > 0,
+                                np.ceil(propmass_host / np.where(mfr_host * dt_host > 0,
+                                                                 mfr_host * dt_host, 1.0)),
+                                0.0)
+    n_steps_host = np.nan_to_num(n_steps_host).astype(np.int64)
+    max_steps = int(n_steps_host.max()) if n else 0
+    n_steps = xp.asarray(n_steps_host)
+
+    table = get_atmosphere_table()
+    atm_altitudes = xp.asarray(table.altitudes)
+    atm_pressures = xp.asarray(table.pressures)
+    atm_densities = xp.asarray(table.densities)
+    atm_sos = xp.asarray(table.speeds_of_sound)
+
+    velocity = xp.zeros(n)
+    altitude = xp.asarray(column("altitude", 0.0))
+    delta_v = xp.zeros(n)
+    max_altitude = altitude.copy()
+    max_velocity = xp.zeros(n)
+    max_thrust = xp.zeros(n)
+    final_time = xp.zeros(n)
+
+    if decimate_to > 0 and max_steps > 0:
+        stride = max(max_steps // decimate_to, 1)
+        n_cols = (max_steps + stride - 1) // stride
+        altitude_traj = xp.zeros((n, n_cols))
+        velocity_traj = xp.zeros((n, n_cols))
+    else:
+        stride = 0
+        altitude_traj = velocity_traj = None
+
+    def drag_force(v, h):
+        alt = xp.clip(h, 0.0, None)
+        density = xp.interp(alt, atm_altitudes, atm_densities)
+        sos = xp.maximum(xp.interp(alt, atm_altitudes, atm_sos), 0.1)
+        mach = xp.abs(v) / sos
+        cd = xp.where(mach < 0.8, 0.3,
+                      xp.where(mach < 1.1,
+                               0.3 + (mach - 0.8) * 1.0,
+                               0.6 - 0.1 * xp.minimum(mach - 1.1, 0.4)))
+        drag = 0.5 * density * v ** 2 * area * cd
+        return xp.where(v > 0, drag, -drag)
+
+    for i in range(max_steps):
+        active = i < n_steps
+        mass = xp.maximum(intmass - mfr * dt * i, intmass - xp.asarray(propmass_host))
+        mass = xp.maximum(mass, 1e-9)
+
+        ap = xp.interp(xp.clip(altitude, 0.0, None), atm_altitudes, atm_pressures)
+        pressure_ratio = xp.where(cocp > 0, (ap / cocp) ** ((k - 1.0) / k), 0.0)
+        ve = xp.sqrt(xp.clip(2.0 * k / (k - 1.0) * R * ct * (1.0 - pressure_ratio), 0.0, None))
+        thrust = mfr * ve
+
+        acceleration = thrust / mass - 9.81 - drag_force(velocity, altitude) / mass
+        velocity_mid = velocity + 0.5 * acceleration * dt
+        altitude_mid = altitude + 0.5 * velocity * dt
+        acceleration_mid = thrust / mass - 9.81 - drag_force(velocity_mid, altitude_mid) / mass
+
+        velocity_new = velocity + acceleration_mid * dt
+        altitude_new = altitude + velocity_mid * dt
+
+        delta_v = delta_v + xp.where(active, xp.maximum(velocity_new - velocity, 0.0), 0.0)
+        velocity = xp.where(active, velocity_new, velocity)
+        altitude = xp.where(active, altitude_new, altitude)
+        final_time = final_time + xp.where(active, dt, 0.0)
+        max_altitude = xp.maximum(max_altitude, altitude)
+        max_velocity = xp.maximum(max_velocity, velocity)
+        max_thrust = xp.maximum(max_thrust, xp.where(active, thrust, 0.0))
+
+        if stride and i % stride == 0:
+            altitude_traj[:, i // stride] = altitude
+            velocity_traj[:, i // stride] = velocity
+
+        if progress_callback and (i + 1) % 256 == 0:
+            progress_callback(i + 1, max_steps)
+
+    results = {
+        "max_altitude": to_numpy(max_altitude),
+        "max_velocity": to_numpy(max_velocity),
+        "delta_v": to_numpy(delta_v),
+        "final_time": to_numpy(final_time),
+        "max_thrust": to_numpy(max_thrust),
+        "steps": n_steps_host.astype(np.float64),
+        "cases": configs
+    }
+    if stride:
+        results["altitude_trajectories"] = to_numpy(altitude_traj)
+        results["velocity_trajectories"] = to_numpy(velocity_traj)
+    return results
+
+
 def nozzle_performance(mfr, ve, expa, amp, ea):
-    thrust = (mfr * ve) + ((expa - amp) * ea)
-    isp = thrust / (mfr * 9.81) if mfr > 0 else 0.0
+    """Nozzle performance metrics for scalars or broadcastable arrays.
+
+    Scalar inputs return plain floats as before; array inputs evaluate
+    the whole design space in one vectorized pass.
+    """
+    mfr, ve, expa, amp, ea = np.broadcast_arrays(
+        *[np.asarray(x, dtype=np.float64) for x in (mfr, ve, expa, amp, ea)])
+
+    pressure_thrust = (expa - amp) * ea
+    momentum_thrust = mfr * ve
+    thrust = momentum_thrust + pressure_thrust
+    isp = np.divide(thrust, mfr * 9.81, out=np.zeros_like(thrust), where=mfr > 0)
 
     expansion_ratio = ea / 0.01
-    pressure_ratio = expa / amp if amp > 0 else 0
+    pressure_ratio = np.divide(expa, amp, out=np.zeros_like(expa), where=amp > 0)
 
-    ideal_expansion = abs(expa - amp) < 0.1 * amp
-    efficiency = 0.95 if ideal_expansion else 0.85 - 0.1 * min(abs(math.log10(pressure_ratio + 0.1)), 1.0)
+    ideal_expansion = np.abs(expa - amp) < 0.1 * amp
+    efficiency = np.where(
+        ideal_expansion, 0.95,
+        0.85 - 0.1 * np.minimum(np.abs(np.log10(pressure_ratio + 0.1)), 1.0))
 
-    return {
+    result = {
         "thrust": thrust,
         "isp": isp,
-        "pressure_thrust": (expa - amp) * ea,
-        "momentum_thrust": mfr * ve,
+        "pressure_thrust": pressure_thrust,
+        "momentum_thrust": momentum_thrust,
         "expansion_ratio": expansion_ratio,
         "pressure_ratio": pressure_ratio,
         "efficiency": efficiency
     }
+    if thrust.ndim == 0:
+        return {name: float(value) for name, value in result.items()}
+    return result
+
+
+_nozzle_grid_cache = {}
+
+
+def nozzle_design_grid(exit_areas, chamber_pressures, throat_area, amp=101325.0,
+                       combustion_temp=3500.0, k=1.2, R=287.0):
+    """Evaluate nozzle_performance over an exit area x chamber pressure grid.
+
+    Exhaust velocity, mass flow and exit pressure are derived from the
+    chamber state with the same relations the nozzle designer uses, with
+    exit pressure estimated from the expansion ratio so both grid axes
+    matter. The whole grid is one vectorized pass, and finished grids are
+    cached keyed by the fixed parameters and grid extents so re-opening
+    the designer is instant.
+    """
+    exit_areas = np.asarray(exit_areas, dtype=np.float64)
+    chamber_pressures = np.asarray(chamber_pressures, dtype=np.float64)
+
+    key = (float(exit_areas[0]), float(exit_areas[-1]), len(exit_areas),
+           float(chamber_pressures[0]), float(chamber_pressures[-1]), len(chamber_pressures),
+           float(throat_area), float(amp), float(combustion_temp), float(k), float(R))
+    if key in _nozzle_grid_cache:
+        return _nozzle_grid_cache[key]
+
+    ea_grid, pc_grid = np.meshgrid(exit_areas, chamber_pressures, indexing="ij")
+    expansion_ratio = ea_grid / throat_area
+    exit_pressure = pc_grid * expansion_ratio ** -k
+    ve = np.sqrt(np.clip(
+        2 * k / (k - 1) * R * combustion_temp * (1 - (exit_pressure / pc_grid) ** ((k - 1) / k)),
+        0.0, None))
+    mfr = np.divide(throat_area * pc_grid, ve * k,
+                    out=np.zeros_like(ve), where=ve > 0)
+
+    grid = nozzle_performance(mfr, ve, exit_pressure, amp, ea_grid)
+    grid["exit_areas"] = exit_areas
+    grid["chamber_pressures"] = chamber_pressures
+    _nozzle_grid_cache[key] = grid
+    return grid
 
 
 def generate_atmosphere_profile(max_altitude=100000, steps=100):
     altitudes = np.linspace(0, max_altitude, steps)
-    pressures = [get_atmospheric_pressure(alt) for alt in altitudes]
+    pressures = get_atmosphere_table().pressure_batch(altitudes)
     temperatures = [288.15 - min(alt / 100, 80) for alt in altitudes]
 
     return {
@@ -1,26 +1,128 @@
 import tkinter as tk
 from tkinter import messagebox, scrolledtext, ttk, filedialog, simpledialog
-import matplotlib
-matplotlib.use('TkAgg')
-from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg
-from matplotlib.figure import Figure
-from matplotlib.animation import FuncAnimation
 import numpy as np
 import csv
 from datetime import datetime
 import time
 import os
+import threading
+import queue
 from Engine import rocket_simulation, nozzle_performance, get_atmospheric_pressure
 from config import config
 from project_manager import ProjectManager, SimulationConfig
 from advanced_engine import AdvancedRocketEngine, Stage, OrbitalMechanics, ThermalAnalysis
-from report_generator import ReportGenerator
-from mpl_toolkits.mplot3d import Axes3D  # For 3D plotting
+from simulation_result import SimulationResult
 import math
+
+# The matplotlib stack (and the reportlab-based report generator) load
+# lazily so the main window and input panel come up on tkinter + stdlib
+# alone; _ensure_plotting() fills these module names in on first use and
+# is warmed in a background thread right after the window paints.
+matplotlib = None
+Figure = None
+FigureCanvasTkAgg = None
+FuncAnimation = None
+_plotting_lock = threading.Lock()
+
+
+def _ensure_plotting():
+    global matplotlib, Figure, FigureCanvasTkAgg, FuncAnimation
+    with _plotting_lock:
+        if matplotlib is not None:
+            return
+        import matplotlib as mpl
+        mpl.use('TkAgg')
+        from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg as canvas_cls
+        from matplotlib.figure import Figure as figure_cls
+        from matplotlib.animation import FuncAnimation as animation_cls
+        import mpl_toolkits.mplot3d  # noqa: F401  (registers the 3d projection)
+        Figure = figure_cls
+        FigureCanvasTkAgg = canvas_cls
+        FuncAnimation = animation_cls
+        matplotlib = mpl
 import urllib.request
 import sys
 
 
+class VirtualDataTable(ttk.Frame):
+    """Virtualized table over the simulation result arrays.
+
+    The result series stay as the backing store; only the window of rows
+    currently in view is materialized into the Treeview, and the window is
+    re-rendered as the scrollbar moves. Opening a million-step run costs
+    the same as a hundred-step one.
+    """
+
+    WINDOW_ROWS = 100
+
+    def __init__(self, parent, columns):
+        super().__init__(parent)
+        self.columns = columns
+        self.data = None
+        self.total_rows = 0
+        self.window_start = 0
+
+        self.tree = ttk.Treeview(self, columns=[name for name, _ in columns],
+                                 show='headings', height=20)
+        for name, heading in columns:
+            self.tree.heading(name, text=heading)
+            self.tree.column(name, width=110, anchor='e')
+
+        self.scrollbar = ttk.Scrollbar(self, orient=tk.VERTICAL, command=self._on_scroll)
+        self.tree.configure(yscrollcommand=lambda first, last: None)
+        self.tree.bind('<MouseWheel>', self._on_wheel)
+        self.tree.bind('<Button-4>', self._on_wheel)
+        self.tree.bind('<Button-5>', self._on_wheel)
+
+        self.tree.pack(side=tk.LEFT, fill=tk.BOTH, expand=True)
+        self.scrollbar.pack(side=tk.RIGHT, fill=tk.Y)
+
+    def set_data(self, results):
+        self.data = [np.asarray(results.get(name, []), dtype=float) for name, _ in self.columns]
+        self.total_rows = min((len(col) for col in self.data), default=0)
+        self.window_start = 0
+        self._render_window()
+
+    def _render_window(self):
+        self.tree.delete(*self.tree.get_children())
+        if self.total_rows == 0:
+            self.scrollbar.set(0.0, 1.0)
+            return
+
+        start = self.window_start
+        end = min(start + self.WINDOW_ROWS, self.total_rows)
+
+        # Column-wise formatting of just the visible slice
+        formatted = [np.char.mod('%.2f', col[start:end]) for col in self.data]
+        for row in zip(*formatted):
+            self.tree.insert('', tk.END, values=row)
+
+        self.scrollbar.set(start / self.total_rows, end / self.total_rows)
+
+    def _scroll_to(self, start):
+        max_start = max(0, self.total_rows - self.WINDOW_ROWS)
+        start = min(max(0, start), max_start)
+        if start != self.window_start:
+            self.window_start = start
+            self._render_window()
+
+    def _on_scroll(self, action, amount, unit=None):
+        if self.total_rows == 0:
+            return
+        if action == 'moveto':
+            self._scroll_to(int(float(amount) * self.total_rows))
+        elif action == 'scroll':
+            step = self.WINDOW_ROWS if unit == 'pages' else 5
+            self._scroll_to(self.window_start + int(amount) * step)
+
+    def _on_wheel(self, event):
+        if event.num == 4 or getattr(event, 'delta', 0) > 0:
+            self._scroll_to(self.window_start - 5)
+        else:
+            self._scroll_to(self.window_start + 5)
+        return 'break'
+
+
 class FlarePieApp:
     def __init__(self, root):
         self.root = root
@@ -39,7 +141,7 @@ class FlarePieApp:
 
         self.project_manager = ProjectManager()
         self.advanced_engine = AdvancedRocketEngine()
-        self.report_generator = ReportGenerator()
+        self.report_generator = None  # constructed on first export (pulls in reportlab)
         self.thermal_analysis = ThermalAnalysis()
         
         self.animation = None
@@ -49,6 +151,9 @@ class FlarePieApp:
         self.undo_stack = []
         self.redo_stack = []
         self._tooltip = None
+        self._worker_thread = None
+        self._worker_queue = queue.Queue()
+        self._cancel_event = threading.Event()
 
         self.create_custom_style()
         self.create_menu_bar()
@@ -81,6 +186,8 @@ class FlarePieApp:
         sim_menu.add_command(label="Run Basic Simulation", command=self.run_rocket_simulation)
         sim_menu.add_command(label="Orbital Analysis", command=self.run_orbital_analysis)
         sim_menu.add_command(label="Thermal Analysis", command=self.run_thermal_analysis)
+        sim_menu.add_command(label="Monte Carlo Dispersion", command=self.run_monte_carlo_analysis)
+        sim_menu.add_command(label="2D Trajectory (Gravity Turn)", command=self.run_trajectory_2d)
         
         view_menu = tk.Menu(menubar, tearoff=0)
         menubar.add_cascade(label="View", menu=view_menu)
@@ -100,6 +207,8 @@ class FlarePieApp:
                  bg=config.get("theme.success_color", "#4CAF50"), fg="white").pack(side=tk.LEFT, padx=2)
         tk.Button(toolbar, text="Stop", command=self.stop_animation,
                  bg=config.get("theme.error_color", "#F44336"), fg="white").pack(side=tk.LEFT, padx=2)
+        tk.Button(toolbar, text="Cancel", command=self.cancel_simulation,
+                 bg=config.get("theme.warning_color", "#FF9800"), fg="white").pack(side=tk.LEFT, padx=2)
         
         ttk.Separator(toolbar, orient=tk.VERTICAL).pack(side=tk.LEFT, padx=5, fill=tk.Y)
         
@@ -108,6 +217,58 @@ class FlarePieApp:
         tk.Button(toolbar, text="3D View", command=self.show_3d_trajectory,
                  bg=config.get("theme.accent_color", "#415A77"), fg="white").pack(side=tk.LEFT, padx=2)
 
+    def run_in_background(self, work, on_done, description="Running simulation..."):
+        """Dispatch work(cancel_event) to a worker thread.
+
+        The outcome is marshalled back to the Tk event thread through a
+        queue drained by root.after polling, so long simulations never
+        freeze the window. Only one worker runs at a time; Cancel sets the
+        event and drops the result when the worker notices it.
+        """
+        if self._worker_thread is not None and self._worker_thread.is_alive():
+            messagebox.showinfo("Busy", "A simulation is already running")
+            return
+
+        self._cancel_event.clear()
+        self.status_var.set(description)
+
+        def target():
+            try:
+                self._worker_queue.put((on_done, work(self._cancel_event), None))
+            except Exception as exc:
+                self._worker_queue.put((on_done, None, exc))
+
+        self._worker_thread = threading.Thread(target=target, daemon=True)
+        self._worker_thread.start()
+        self.root.after(100, self._poll_worker)
+
+    def _poll_worker(self):
+        try:
+            on_done, outcome, error = self._worker_queue.get_nowait()
+        except queue.Empty:
+            if self._worker_thread is not None and self._worker_thread.is_alive():
+                self.root.after(100, self._poll_worker)
+            return
+
+        self._worker_thread = None
+        if self._cancel_event.is_set():
+            self.status_var.set("Simulation cancelled")
+            return
+        if error is not None:
+            messagebox.showerror("Error", str(error))
+            self.status_var.set("Simulation failed")
+            return
+        try:
+            on_done(outcome)
+        except Exception as exc:
+            messagebox.showerror("Error", str(exc))
+            self.status_var.set("Simulation failed")
+
+    def cancel_simulation(self):
+        if self._worker_thread is not None and self._worker_thread.is_alive():
+            self._cancel_event.set()
+            self.status_var.set("Cancelling...")
+
     def load_default_config(self):
         default_values = {
             "fuel_type": config.get("simulation.default_fuel_type", "RP1"),
@@ -405,11 +566,54 @@ class FlarePieApp:
         self.tab_control.add(self.charts_tab, text="Static Charts")
         self.tab_control.add(self.data_tab, text="Data & Results")
 
+        # The chart views need matplotlib; show placeholders now and build
+        # them once the plotting stack has warmed in the background, so
+        # cold start to an interactive input panel stays sub-second.
+        self._chart_placeholders = []
+        self._views_ready = False
+        self._pending_display = None
+        for tab in (self.realtime_tab, self.charts_tab, self.data_tab):
+            label = ttk.Label(tab, text="Loading chart views...")
+            label.pack(padx=20, pady=20)
+            self._chart_placeholders.append(label)
+        self.root.after(50, self._warm_plotting)
+
+    def _warm_plotting(self):
+        def warm():
+            _ensure_plotting()
+            self.root.after(0, self._build_output_views)
+        threading.Thread(target=warm, daemon=True).start()
+
+    def _build_output_views(self):
+        for label in self._chart_placeholders:
+            label.destroy()
+        self._chart_placeholders = []
         self.setup_realtime_view()
-
         self.setup_static_charts()
-
         self.setup_data_view()
+        self._views_ready = True
+        if self._pending_display is not None:
+            results, status, animate = self._pending_display
+            self._pending_display = None
+            self._display_results(results, status, animate)
+
+    def _display_results(self, results, status, animate=False):
+        """Show a finished result in the chart/data views.
+
+        A simulation (or a cache hit) can complete before the background
+        matplotlib warm has built the views; in that case hold the
+        result and flush it from _build_output_views instead of hitting
+        widgets that do not exist yet.
+        """
+        if not self._views_ready:
+            self._pending_display = (results, status, animate)
+            self.status_var.set("Simulation complete - preparing chart views...")
+            return
+        self.update_static_charts(results)
+        self.update_data_view(results)
+        if animate:
+            self.start_animation(results)
+        self.status_var.set(status)
 
     def setup_realtime_view(self):
         plt_style = {'figure.facecolor': '#232931',
@@ -549,12 +753,22 @@ class FlarePieApp:
         self.result_text = scrolledtext.ScrolledText(
             results_frame,
             width=80,
-            height=15,
+            height=10,
             font=("Consolas", 10),
             bg="#1E1E1E",
             fg="#E0E1DD"
         )
-        self.result_text.pack(fill=tk.BOTH, expand=True)
+        self.result_text.pack(fill=tk.X)
+
+        self.data_table = VirtualDataTable(results_frame, columns=[
+            ("time", "Time (s)"),
+            ("thrust", "Thrust (N)"),
+            ("velocity", "Velocity (m/s)"),
+            ("altitude", "Altitude (m)"),
+            ("fuel_remaining", "Fuel (kg)"),
+            ("isp_values", "ISP (s)")
+        ])
+        self.data_table.pack(fill=tk.BOTH, expand=True, pady=(5, 0))
 
         summary_frame = ttk.Frame(self.data_tab)
         summary_frame.pack(fill=tk.BOTH, expand=True, padx=5, pady=5)
@@ -592,6 +806,31 @@ class FlarePieApp:
         )
         status_bar.pack(side=tk.BOTTOM, fill=tk.X)
 
+    def _simulation_cache_params(self):
+        """Canonical result-cache key built from the current GUI inputs.
+
+        Both the run path and the report export key the cache with this
+        exact dict; building it in one place keeps the hashes identical
+        so a report can fall back to the cached run.
+        """
+        enable_failure = self.enable_failure_var.get()
+        enable_abort = self.enable_abort_var.get()
+        return {
+            "fuel_type": self.rocket_vars["fuel_type"].get(),
+            "cocp": float(self.rocket_vars["cocp"].get()),
+            "ct": float(self.rocket_vars["ct"].get()),
+            "altitude": float(self.rocket_vars["altitude"].get()),
+            "intmass": float(self.rocket_vars["intmass"].get()),
+            "propmass": float(self.rocket_vars["propmass"].get()),
+            "mfr": float(self.nozzle_vars["mfr"].get()) if "mfr" in self.nozzle_vars else float(self.rocket_vars["mfr"].get()),
+            "dt": float(self.rocket_vars["dt"].get()),
+            "reference_area": float(self.rocket_vars["reference_area"].get()),
+            "failure_time": float(self.failure_time_var.get()) if enable_failure else None,
+            "abort_time": float(self.abort_time_var.get()) if enable_abort else None,
+            "parachute_area": float(self.parachute_area_var.get()) if enable_abort else 0.0,
+            "parachute_cd": float(self.parachute_cd_var.get()) if enable_abort else 0.0
+        }
+
     def run_rocket_simulation(self):
         try:
             fuel_type = self.rocket_vars["fuel_type"].get()
@@ -617,121 +856,146 @@ class FlarePieApp:
 
             self.status_var.set("Running simulation...")
 
-            from Engine import get_atmospheric_pressure, calculate_drag
-            k, R = {"RP1": (1.2, 287.0), "LH2": (1.4, 4124.0), "SRF": (1.2, 191.0), "N2O4": (1.26, 320.0)}[fuel_type]
-            current_mass = intmass
-            time_elapsed = 0.0
-            velocity = 0.0
-            current_altitude = altitude
-            delta_v = 0.0
-            energy_values = []
-            drag_values = []
-            acceleration_values = []
-            time_steps = []
-            thrust_values = []
-            fuel_remaining = []
-            mass_flow_values = []
-            velocity_values = []
-            altitude_values = []
-            isp_values = []
-            failure_event_idx = None
-            abort_event_idx = None
-            abort_triggered = False
-            max_time = 10000.0
-            max_iterations = 200000
-            iterations = 0
-            while (propmass > 0 or (abort_triggered and current_altitude > 0.5 and abs(velocity) > 0.5)) and time_elapsed < max_time and iterations < max_iterations:
-                ap = get_atmospheric_pressure(current_altitude)
-                pressure_ratio = (ap / cocp) ** ((k - 1) / k) if cocp > 0 else 0.0
-                ve = (2.0 * k) / (k - 1.0) * R * ct * (1.0 - pressure_ratio)
-                ve = max(0.0, ve) ** 0.5
-                thrust = mfr * ve
-                if enable_failure and failure_time is not None and time_elapsed >= failure_time:
-                    if failure_event_idx is None:
-                        failure_event_idx = len(time_steps)
-                    thrust = 0.0
-                    mfr = 0.0
-                if enable_abort and abort_time is not None and time_elapsed >= abort_time:
-                    if abort_event_idx is None:
-                        abort_event_idx = len(time_steps)
-                        abort_triggered = True
-                    thrust = 0.0
-                    mfr = 0.0
-                mass_used = min(mfr * dt, propmass)
-                propmass -= mass_used
-                current_mass -= mass_used
-                if abort_triggered:
-                    p0 = 1.225
-                    h0 = 8500
-                    density = p0 * math.exp(-current_altitude / h0)
-                    drag = 0.5 * density * velocity ** 2 * parachute_area * parachute_cd * (-1 if velocity > 0 else 1)
-                else:
-                    drag = calculate_drag(velocity, current_altitude, reference_area)
-                acceleration = (thrust / current_mass) - 9.81 - (drag / current_mass)
-                velocity_mid = velocity + 0.5 * acceleration * dt
-                altitude_mid = current_altitude + 0.5 * velocity * dt
-                if abort_triggered:
-                    density_mid = p0 * math.exp(-altitude_mid / h0)
-                    drag_mid = 0.5 * density_mid * velocity_mid ** 2 * parachute_area * parachute_cd * (-1 if velocity_mid > 0 else 1)
-                else:
-                    drag_mid = calculate_drag(velocity_mid, altitude_mid, reference_area)
-                acceleration_mid = (thrust / current_mass) - 9.81 - (drag_mid / current_mass)
-                velocity_new = velocity + acceleration_mid * dt
-                altitude_new = current_altitude + velocity_mid * dt
-                delta_v_step = max(0.0, velocity_new - velocity)
-                delta_v += delta_v_step
-                kinetic_energy = 0.5 * current_mass * velocity ** 2
-                potential_energy = current_mass * 9.81 * current_altitude
-                energy_values.append(kinetic_energy + potential_energy)
-                isp = thrust / (mfr * 9.81) if mfr > 0 else 0.0
-                time_steps.append(time_elapsed)
-                thrust_values.append(thrust)
-                fuel_remaining.append(propmass)
-                mass_flow_values.append(mfr)
-                velocity_values.append(velocity)
-                altitude_values.append(current_altitude)
-                isp_values.append(isp)
-                drag_values.append(drag)
-                acceleration_values.append(acceleration)
-                velocity = velocity_new
-                current_altitude = altitude_new
-                time_elapsed += dt
-                iterations += 1
-                # Ensure after abort, rocket lands
-                if abort_triggered and current_altitude <= 0:
-                    break
-                if thrust == 0.0 and propmass <= 0 and not abort_triggered:
-                    break
-            results = {
-                "time": time_steps,
-                "thrust": thrust_values,
-                "fuel_remaining": fuel_remaining,
-                "mass_flow": mass_flow_values,
-                "velocity": velocity_values,
-                "altitude": altitude_values,
-                "isp_values": isp_values,
-                "energy": energy_values,
-                "drag": drag_values,
-                "acceleration": acceleration_values,
-                "final_time": time_elapsed,
-                "initial_thrust": thrust_values[0] if thrust_values else 0,
-                "delta_v": delta_v,
-                "simulation_complete": True,
-                "failure_event_idx": failure_event_idx,
-                "abort_event_idx": abort_event_idx
-            }
-            self.simulation_data = results
-            self.update_static_charts(results)
-            self.update_data_view(results)
-            if self.animate_var.get():
-                self.start_animation(results)
-            if self.save_var.get():
-                self.save_results(results)
-            self.status_var.set("Simulation complete")
+            from result_cache import get_result_cache
+            cache = get_result_cache()
+            cache_params = self._simulation_cache_params()
+            cached = cache.get(cache_params)
+            if cached is not None:
+                cached = SimulationResult.from_dict(cached)
+                self.simulation_data = cached
+                self._display_results(cached, "Simulation complete (cached)",
+                                      animate=self.animate_var.get())
+                return
+
+            def work(cancel_event):
+                return self._simulate_with_events(
+                    fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
+                    reference_area, enable_failure, failure_time, enable_abort,
+                    abort_time, parachute_area, parachute_cd, cancel_event)
+
+            def on_done(results):
+                results = SimulationResult.from_dict(results)
+                cache.put(cache_params, results)
+                self.simulation_data = results
+                if self.save_var.get():
+                    self.save_results(results)
+                self._display_results(results, "Simulation complete",
+                                      animate=self.animate_var.get())
+
+            self.run_in_background(work, on_done)
         except ValueError as e:
             messagebox.showerror("Input Error", f"Please enter valid numeric values: {str(e)}")
             self.status_var.set("Simulation failed")
 
+    def _simulate_with_events(self, fuel_type, cocp, ct, altitude, intmass, propmass, mfr, dt,
+                              reference_area, enable_failure, failure_time, enable_abort,
+                              abort_time, parachute_area, parachute_cd, cancel_event=None):
+        from Engine import get_atmospheric_pressure, calculate_drag
+        k, R = {"RP1": (1.2, 287.0), "LH2": (1.4, 4124.0), "SRF": (1.2, 191.0), "N2O4": (1.26, 320.0)}[fuel_type]
+        current_mass = intmass
+        time_elapsed = 0.0
+        velocity = 0.0
+        current_altitude = altitude
+        delta_v = 0.0
+        energy_values = []
+        drag_values = []
+        acceleration_values = []
+        time_steps = []
+        thrust_values = []
+        fuel_remaining = []
+        mass_flow_values = []
+        velocity_values = []
+        altitude_values = []
+        isp_values = []
+        failure_event_idx = None
+        abort_event_idx = None
+        abort_triggered = False
+        max_time = 10000.0
+        max_iterations = 200000
+        iterations = 0
+        while (propmass > 0 or (abort_triggered and current_altitude > 0.5 and abs(velocity) > 0.5)) and time_elapsed < max_time and iterations < max_iterations:
+            if cancel_event is not None and cancel_event.is_set():
+                break
+            ap = get_atmospheric_pressure(current_altitude)
+            pressure_ratio = (ap / cocp) ** ((k - 1) / k) if cocp > 0 else 0.0
+            ve = (2.0 * k) / (k - 1.0) * R * ct * (1.0 - pressure_ratio)
+            ve = max(0.0, ve) ** 0.5
+            thrust = mfr * ve
+            if enable_failure and failure_time is not None and time_elapsed >= failure_time:
+                if failure_event_idx is None:
+                    failure_event_idx = len(time_steps)
+                thrust = 0.0
+                mfr = 0.0
+            if enable_abort and abort_time is not None and time_elapsed >= abort_time:
+                if abort_event_idx is None:
+                    abort_event_idx = len(time_steps)
+                    abort_triggered = True
+                thrust = 0.0
+                mfr = 0.0
+            mass_used = min(mfr * dt, propmass)
+            propmass -= mass_used
+            current_mass -= mass_used
+            if abort_triggered:
+                p0 = 1.225
+                h0 = 8500
+                density = p0 * math.exp(-current_altitude / h0)
+                drag = 0.5 * density * velocity ** 2 * parachute_area * parachute_cd * (-1 if velocity > 0 else 1)
+            else:
+                drag = calculate_drag(velocity, current_altitude, reference_area)
+            acceleration = (thrust / current_mass) - 9.81 - (drag / current_mass)
+            velocity_mid = velocity + 0.5 * acceleration * dt
+            altitude_mid = current_altitude + 0.5 * velocity * dt
+            if abort_triggered:
+                density_mid = p0 * math.exp(-altitude_mid / h0)
+                drag_mid = 0.5 * density_mid * velocity_mid ** 2 * parachute_area * parachute_cd * (-1 if velocity_mid > 0 else 1)
+            else:
+                drag_mid = calculate_drag(velocity_mid, altitude_mid, reference_area)
+            acceleration_mid = (thrust / current_mass) - 9.81 - (drag_mid / current_mass)
+            velocity_new = velocity + acceleration_mid * dt
+            altitude_new = current_altitude + velocity_mid * dt
+            delta_v_step = max(0.0, velocity_new - velocity)
+            delta_v += delta_v_step
+            kinetic_energy = 0.5 * current_mass * velocity ** 2
+            potential_energy = current_mass * 9.81 * current_altitude
+            energy_values.append(kinetic_energy + potential_energy)
+            isp = thrust / (mfr * 9.81) if mfr > 0 else 0.0
+            time_steps.append(time_elapsed)
+            thrust_values.append(thrust)
+            fuel_remaining.append(propmass)
+            mass_flow_values.append(mfr)
+            velocity_values.append(velocity)
+            altitude_values.append(current_altitude)
+            isp_values.append(isp)
+            drag_values.append(drag)
+            acceleration_values.append(acceleration)
+            velocity = velocity_new
+            current_altitude = altitude_new
+            time_elapsed += dt
+            iterations += 1
+            # Ensure after abort, rocket lands
+            if abort_triggered and current_altitude <= 0:
+                break
+            if thrust == 0.0 and propmass <= 0 and not abort_triggered:
+                break
+        return {
+            "time": time_steps,
+            "thrust": thrust_values,
+            "fuel_remaining": fuel_remaining,
+            "mass_flow": mass_flow_values,
+            "velocity": velocity_values,
+            "altitude": altitude_values,
+            "isp_values": isp_values,
+            "energy": energy_values,
+            "drag": drag_values,
+            "acceleration": acceleration_values,
+            "final_time": time_elapsed,
+            "initial_thrust": thrust_values[0] if thrust_values else 0,
+            "delta_v": delta_v,
+            "simulation_complete": True,
+            "failure_event_idx": failure_event_idx,
+            "abort_event_idx": abort_event_idx
+        }
+
     def run_nozzle_analysis(self):
         try:
             mfr = float(self.nozzle_vars["mfr"].get())
@@ -765,19 +1029,24 @@ class FlarePieApp:
             self.status_var.set("Nozzle analysis failed")
 
     def start_animation(self, results):
-        self.stop_animation()
+        from plot_utils import decimate_uniform
 
-        time_data = results['time']
-        velocity_data = results['velocity']
-        altitude_data = results['altitude']
-        fuel_data = results['fuel_remaining']
-        thrust_data = results['thrust']
+        self.stop_animation()
 
-        max_time = max(time_data) if time_data else 1
-        max_velocity = max(velocity_data) if velocity_data else 1
-        max_altitude = max(altitude_data) if altitude_data else 1
-        max_fuel = max(fuel_data) if fuel_data else 1
-        max_thrust = max(thrust_data) if thrust_data else 1
+        # The persistent Line2D artists are blitted, so each frame only
+        # redraws the changed regions; feeding them decimated series keeps
+        # per-frame cost flat no matter how fine the simulation dt was.
+        time_data = decimate_uniform(results['time'])
+        velocity_data = decimate_uniform(results['velocity'])
+        altitude_data = decimate_uniform(results['altitude'])
+        fuel_data = decimate_uniform(results['fuel_remaining'])
+        thrust_data = decimate_uniform(results['thrust'])
+
+        max_time = float(np.max(time_data)) if len(time_data) else 1
+        max_velocity = float(np.max(velocity_data)) if len(velocity_data) else 1
+        max_altitude = float(np.max(altitude_data)) if len(altitude_data) else 1
+        max_fuel = float(np.max(fuel_data)) if len(fuel_data) else 1
+        max_thrust = float(np.max(thrust_data)) if len(thrust_data) else 1
 
         self.rt_ax1.set_xlim(0, max_time * 1.1)
         self.rt_ax1.set_ylim(0, max_velocity * 1.1)
@@ -810,11 +1079,12 @@ class FlarePieApp:
 
             return self.velocity_line, self.altitude_line, self.fuel_line, self.thrust_line
 
+        fps = max(1, int(config.get("visualization.animation_fps", 24)))
         self.animation = FuncAnimation(
             self.rt_fig,
             animate,
             frames=120,
-            interval=50,
+            interval=int(1000 / fps),
             blit=True,
             repeat=False
         )
@@ -832,16 +1102,32 @@ class FlarePieApp:
             self.animation = None
 
     def update_static_charts(self, results):
-        time_data = results['time']
-        thrust_data = results['thrust']
-        isp_data = results['isp_values']
-        mass_flow_data = results['mass_flow']
-        fuel_data = results['fuel_remaining']
-        velocity_data = results['velocity']
-        altitude_data = results['altitude']
+        from plot_utils import decimate_envelope
+        from profiling import get_profiler
+
+        profiler = get_profiler()
+        chart_started = time.perf_counter()
+
+        time_data = np.asarray(results['time'], dtype=float)
+        thrust_data = np.asarray(results['thrust'], dtype=float)
+        isp_data = np.asarray(results['isp_values'], dtype=float)
+        mass_flow_data = np.asarray(results['mass_flow'], dtype=float)
+        fuel_data = np.asarray(results['fuel_remaining'], dtype=float)
+        velocity_data = np.asarray(results['velocity'], dtype=float)
+        altitude_data = np.asarray(results['altitude'], dtype=float)
         failure_idx = results.get('failure_event_idx')
         abort_idx = results.get('abort_event_idx')
 
+        # Decimate every plotted pair to a min/max envelope so redraw cost
+        # scales with pixels, not simulation steps.
+        t_thrust, d_thrust = decimate_envelope(time_data, thrust_data)
+        t_isp, d_isp = decimate_envelope(time_data, isp_data)
+        t_mf, d_mf = decimate_envelope(time_data, mass_flow_data)
+        t_fuel, d_fuel = decimate_envelope(time_data, fuel_data)
+        t_alt, d_alt = decimate_envelope(time_data, altitude_data)
+        t_vel, d_vel = decimate_envelope(time_data, velocity_data)
+        v_env, a_env = decimate_envelope(velocity_data, altitude_data)
+
         self.perf_ax1.clear()
         self.perf_ax2.clear()
         self.perf_ax3.clear()
@@ -852,7 +1138,7 @@ class FlarePieApp:
         self.traj_ax3.clear()
         self.traj_ax4.clear()
 
-        self.perf_ax1.plot(time_data, thrust_data, 'c-', linewidth=2, label='Thrust')
+        self.perf_ax1.plot(t_thrust, d_thrust, 'c-', linewidth=2, label='Thrust')
         self.perf_ax1.set_title("Thrust vs Time", fontsize=12, fontweight='bold')
         self.perf_ax1.set_xlabel("Time (s)", fontsize=10)
         self.perf_ax1.set_ylabel("Thrust (N)", fontsize=10)
@@ -863,12 +1149,12 @@ class FlarePieApp:
             self.perf_ax1.axvline(time_data[failure_idx], color='red', linestyle=':', linewidth=2, label='Engine Failure')
         if abort_idx is not None:
             self.perf_ax1.axvline(time_data[abort_idx], color='orange', linestyle=':', linewidth=2, label='Abort')
-        max_thrust = max(thrust_data) if thrust_data else 0
-        self.perf_ax1.annotate(f"Max: {max_thrust:.0f}", xy=(time_data[thrust_data.index(max_thrust)], max_thrust),
+        max_thrust = float(np.max(thrust_data)) if len(thrust_data) else 0
+        self.perf_ax1.annotate(f"Max: {max_thrust:.0f}", xy=(time_data[int(np.argmax(thrust_data))] if len(thrust_data) else 0, max_thrust),
                                xytext=(10, 10), textcoords='offset points', color='cyan', fontsize=8,
                                arrowprops=dict(arrowstyle='->', color='cyan'))
 
-        self.perf_ax2.plot(time_data, isp_data, 'r-', linewidth=2, label='Isp')
+        self.perf_ax2.plot(t_isp, d_isp, 'r-', linewidth=2, label='Isp')
         self.perf_ax2.set_title("Specific Impulse", fontsize=12, fontweight='bold')
         self.perf_ax2.set_xlabel("Time (s)", fontsize=10)
         self.perf_ax2.set_ylabel("Isp (s)", fontsize=10)
@@ -877,7 +1163,7 @@ class FlarePieApp:
         self.perf_ax2.minorticks_on()
         self.perf_ax2.legend(loc='upper right', fontsize=8, frameon=False)
 
-        self.perf_ax3.plot(time_data, mass_flow_data, 'g-', linewidth=2, label='Mass Flow')
+        self.perf_ax3.plot(t_mf, d_mf, 'g-', linewidth=2, label='Mass Flow')
         self.perf_ax3.set_title("Mass Flow Rate", fontsize=12, fontweight='bold')
         self.perf_ax3.set_xlabel("Time (s)", fontsize=10)
         self.perf_ax3.set_ylabel("Mass Flow (kg/s)", fontsize=10)
@@ -885,27 +1171,27 @@ class FlarePieApp:
         self.perf_ax3.minorticks_on()
         self.perf_ax3.legend(loc='upper right', fontsize=8, frameon=False)
 
-        self.perf_ax4.plot(time_data, fuel_data, 'y-', linewidth=2, label='Fuel Remaining')
+        self.perf_ax4.plot(t_fuel, d_fuel, 'y-', linewidth=2, label='Fuel Remaining')
         self.perf_ax4.set_title("Fuel Remaining", fontsize=12, fontweight='bold')
         self.perf_ax4.set_xlabel("Time (s)", fontsize=10)
         self.perf_ax4.set_ylabel("Fuel (kg)", fontsize=10)
         self.perf_ax4.grid(True, which='both', linestyle='--', alpha=0.6)
         self.perf_ax4.minorticks_on()
         self.perf_ax4.legend(loc='upper right', fontsize=8, frameon=False)
-        min_fuel = min(fuel_data) if fuel_data else 0
-        self.perf_ax4.annotate(f"Min: {min_fuel:.0f}", xy=(time_data[fuel_data.index(min_fuel)], min_fuel),
+        min_fuel = float(np.min(fuel_data)) if len(fuel_data) else 0
+        self.perf_ax4.annotate(f"Min: {min_fuel:.0f}", xy=(time_data[int(np.argmin(fuel_data))] if len(fuel_data) else 0, min_fuel),
                                xytext=(10, -15), textcoords='offset points', color='yellow', fontsize=8,
                                arrowprops=dict(arrowstyle='->', color='yellow'))
 
-        self.traj_ax1.plot(time_data, altitude_data, 'c-', linewidth=2, label='Altitude')
+        self.traj_ax1.plot(t_alt, d_alt, 'c-', linewidth=2, label='Altitude')
         self.traj_ax1.set_title("Altitude vs Time", fontsize=12, fontweight='bold')
         self.traj_ax1.set_xlabel("Time (s)", fontsize=10)
         self.traj_ax1.set_ylabel("Altitude (m)", fontsize=10)
         self.traj_ax1.grid(True, which='both', linestyle='--', alpha=0.6)
         self.traj_ax1.minorticks_on()
         self.traj_ax1.legend(loc='upper right', fontsize=8, frameon=False)
-        max_alt = max(altitude_data) if altitude_data else 0
-        self.traj_ax1.annotate(f"Max: {max_alt:.0f}", xy=(time_data[altitude_data.index(max_alt)], max_alt),
+        max_alt = float(np.max(altitude_data)) if len(altitude_data) else 0
+        self.traj_ax1.annotate(f"Max: {max_alt:.0f}", xy=(time_data[int(np.argmax(altitude_data))] if len(altitude_data) else 0, max_alt),
                                xytext=(10, 10), textcoords='offset points', color='cyan', fontsize=8,
                                arrowprops=dict(arrowstyle='->', color='cyan'))
         if failure_idx is not None:
@@ -913,19 +1199,19 @@ class FlarePieApp:
         if abort_idx is not None:
             self.traj_ax1.axvline(time_data[abort_idx], color='orange', linestyle=':', linewidth=2, label='Abort')
 
-        self.traj_ax2.plot(time_data, velocity_data, 'r-', linewidth=2, label='Velocity')
+        self.traj_ax2.plot(t_vel, d_vel, 'r-', linewidth=2, label='Velocity')
         self.traj_ax2.set_title("Velocity vs Time", fontsize=12, fontweight='bold')
         self.traj_ax2.set_xlabel("Time (s)", fontsize=10)
         self.traj_ax2.set_ylabel("Velocity (m/s)", fontsize=10)
         self.traj_ax2.grid(True, which='both', linestyle='--', alpha=0.6)
         self.traj_ax2.minorticks_on()
         self.traj_ax2.legend(loc='upper right', fontsize=8, frameon=False)
-        max_vel = max(velocity_data) if velocity_data else 0
-        self.traj_ax2.annotate(f"Max: {max_vel:.0f}", xy=(time_data[velocity_data.index(max_vel)], max_vel),
+        max_vel = float(np.max(velocity_data)) if len(velocity_data) else 0
+        self.traj_ax2.annotate(f"Max: {max_vel:.0f}", xy=(time_data[int(np.argmax(velocity_data))] if len(velocity_data) else 0, max_vel),
                                xytext=(10, 10), textcoords='offset points', color='red', fontsize=8,
                                arrowprops=dict(arrowstyle='->', color='red'))
 
-        self.traj_ax3.plot(velocity_data, altitude_data, 'g-', linewidth=2, label='Alt vs Vel')
+        self.traj_ax3.plot(v_env, a_env, 'g-', linewidth=2, label='Alt vs Vel')
         self.traj_ax3.set_title("Altitude vs Velocity", fontsize=12, fontweight='bold')
         self.traj_ax3.set_xlabel("Velocity (m/s)", fontsize=10)
         self.traj_ax3.set_ylabel("Altitude (m)", fontsize=10)
@@ -933,17 +1219,15 @@ class FlarePieApp:
         self.traj_ax3.minorticks_on()
         self.traj_ax3.legend(loc='upper right', fontsize=8, frameon=False)
 
-        tw_ratio = []
-        for t, f in zip(thrust_data, fuel_data):
-            try:
-                mass = float(self.rocket_vars["intmass"].get()) - float(self.rocket_vars["propmass"].get()) + f
-                weight = mass * 9.81
-                ratio = t / weight if weight > 0 else 0
-                tw_ratio.append(ratio)
-            except:
-                tw_ratio.append(0)
-
-        self.traj_ax4.plot(time_data, tw_ratio, 'y-', linewidth=2, label='T/W Ratio')
+        try:
+            dry_mass = float(self.rocket_vars["intmass"].get()) - float(self.rocket_vars["propmass"].get())
+        except (ValueError, tk.TclError):
+            dry_mass = 0.0
+        weight = (dry_mass + fuel_data) * 9.81
+        tw_ratio = np.divide(thrust_data, weight, out=np.zeros_like(thrust_data), where=weight > 0)
+        t_tw, d_tw = decimate_envelope(time_data, tw_ratio)
+
+        self.traj_ax4.plot(t_tw, d_tw, 'y-', linewidth=2, label='T/W Ratio')
         self.traj_ax4.set_title("Thrust/Weight Ratio", fontsize=12, fontweight='bold')
         self.traj_ax4.set_xlabel("Time (s)", fontsize=10)
         self.traj_ax4.set_ylabel("T/W Ratio", fontsize=10)
@@ -957,6 +1241,8 @@ class FlarePieApp:
         self.traj_fig.tight_layout()
         self.traj_canvas.draw()
 
+        profiler.record(profiler.section("gui.update_static_charts"), chart_started)
+
     def update_data_view(self, results):
         self.result_text.delete(1.0, tk.END)
 
@@ -968,33 +1254,16 @@ class FlarePieApp:
         self.result_text.insert(tk.END, f"Initial Thrust: {results['initial_thrust']:.2f} N\n")
         self.result_text.insert(tk.END, f"Delta-V: {results['delta_v']:.2f} m/s\n\n")
 
-        max_velocity = max(results['velocity']) if results['velocity'] else 0
-        max_altitude = max(results['altitude']) if results['altitude'] else 0
-        avg_isp = sum(results['isp_values']) / len(results['isp_values']) if results['isp_values'] else 0
+        max_velocity = max(results['velocity']) if len(results['velocity']) else 0
+        max_altitude = max(results['altitude']) if len(results['altitude']) else 0
+        avg_isp = sum(results['isp_values']) / len(results['isp_values']) if len(results['isp_values']) else 0
 
         self.result_text.insert(tk.END, "─── KEY METRICS ───\n\n")
         self.result_text.insert(tk.END, f"Maximum Velocity: {max_velocity:.2f} m/s\n")
         self.result_text.insert(tk.END, f"Maximum Altitude: {max_altitude:.2f} m\n")
-        self.result_text.insert(tk.END, f"Average ISP: {avg_isp:.2f} s\n\n")
-
-        self.result_text.insert(tk.END, "─── DATA SAMPLES ───\n\n")
-        self.result_text.insert(tk.END,
-                                f"{'Time (s)':<10} {'Thrust (N)':<12} {'Velocity (m/s)':<15} {'Altitude (m)':<12} {'Fuel (kg)':<10} {'ISP (s)':<8}\n")
-        self.result_text.insert(tk.END, "─" * 70 + "\n")
+        self.result_text.insert(tk.END, f"Average ISP: {avg_isp:.2f} s\n")
 
-        num_points = len(results['time'])
-        step = max(1, num_points // 20)
-
-        for i in range(0, num_points, step):
-            t = results['time'][i]
-            thrust = results['thrust'][i]
-            velocity = results['velocity'][i]
-            altitude = results['altitude'][i]
-            fuel = results['fuel_remaining'][i]
-            isp = results['isp_values'][i]
-
-            row = f"{t:<10.2f} {thrust:<12.2f} {velocity:<15.2f} {altitude:<12.2f} {fuel:<10.2f} {isp:<8.2f}\n"
-            self.result_text.insert(tk.END, row)
+        self.data_table.set_data(results)
 
         self.update_summary_chart(results)
 
@@ -1065,6 +1334,19 @@ class FlarePieApp:
     def save_results(self, results):
         try:
             timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
+
+            export_format = config.get("export.default_format", "csv")
+            if export_format == "npz":
+                filename = f"rocket_simulation_{timestamp}.npz"
+                compressed = config.get("export.compression_enabled", False)
+                if isinstance(results, SimulationResult):
+                    results.save_npz(filename, compressed=compressed)
+                else:
+                    from result_io import save_results_binary
+                    save_results_binary(results, filename, compressed=compressed)
+                messagebox.showinfo("File Saved", f"Results saved to {filename}")
+                return
+
             filename = f"rocket_simulation_{timestamp}.csv"
 
             with open(filename, 'w', newline='') as csvfile:
@@ -1121,18 +1403,11 @@ class FlarePieApp:
             return
         
         try:
-            config_data = {
-                "fuel_type": self.rocket_vars["fuel_type"].get(),
-                "cocp": float(self.rocket_vars["cocp"].get()),
-                "ct": float(self.rocket_vars["ct"].get()),
-                "altitude": float(self.rocket_vars["altitude"].get()),
-                "intmass": float(self.rocket_vars["intmass"].get()),
-                "propmass": float(self.rocket_vars["propmass"].get()),
-                "mfr": float(self.rocket_vars["mfr"].get()),
-                "dt": float(self.rocket_vars["dt"].get()),
-                "reference_area": float(self.rocket_vars["reference_area"].get())
-            }
-            
+            config_data = self._simulation_cache_params()
+
+            if self.report_generator is None:
+                from report_generator import ReportGenerator
+                self.report_generator = ReportGenerator()
             report_path = self.report_generator.generate_simulation_report(
                 self.simulation_data, config_data
             )
@@ -1179,25 +1454,77 @@ class FlarePieApp:
             )
             
             self.advanced_engine.stages = [stage1, stage2]
-            results = self.advanced_engine.multi_stage_simulation()
-            
-            if "error" not in results:
-                self.simulation_data = results
-                self.update_static_charts(results)
-                self.update_data_view(results)
-                messagebox.showinfo("Success", "Multi-stage simulation completed")
-            else:
-                messagebox.showerror("Error", results["error"])
+
+            def work(cancel_event):
+                return self.advanced_engine.multi_stage_simulation()
+
+            def on_done(results):
+                if "error" not in results:
+                    results = SimulationResult.from_dict(results)
+                    self.simulation_data = results
+                    self._display_results(results, "Multi-stage simulation complete")
+                    messagebox.showinfo("Success", "Multi-stage simulation completed")
+                else:
+                    self.status_var.set("Multi-stage simulation failed")
+                    messagebox.showerror("Error", results["error"])
+
+            self.run_in_background(work, on_done, "Running multi-stage simulation...")
         except Exception as e:
             messagebox.showerror("Error", f"Multi-stage simulation failed: {str(e)}")
 
+    def run_trajectory_2d(self):
+        try:
+            stage1 = Stage(
+                name="First Stage",
+                fuel_type=self.rocket_vars["fuel_type"].get(),
+                chamber_pressure=float(self.rocket_vars["cocp"].get()),
+                combustion_temp=float(self.rocket_vars["ct"].get()),
+                total_mass=float(self.rocket_vars["intmass"].get()) * 0.8,
+                propellant_mass=float(self.rocket_vars["propmass"].get()) * 0.8,
+                mass_flow_rate=float(self.rocket_vars["mfr"].get()),
+                reference_area=float(self.rocket_vars["reference_area"].get())
+            )
+
+            stage2 = Stage(
+                name="Second Stage",
+                fuel_type=self.rocket_vars["fuel_type"].get(),
+                chamber_pressure=float(self.rocket_vars["cocp"].get()),
+                combustion_temp=float(self.rocket_vars["ct"].get()),
+                total_mass=float(self.rocket_vars["intmass"].get()) * 0.2,
+                propellant_mass=float(self.rocket_vars["propmass"].get()) * 0.2,
+                mass_flow_rate=float(self.rocket_vars["mfr"].get()) * 0.5,
+                reference_area=float(self.rocket_vars["reference_area"].get()) * 0.5
+            )
+
+            self.advanced_engine.stages = [stage1, stage2]
+            dt = float(self.rocket_vars["dt"].get())
+
+            def work(cancel_event):
+                return self.advanced_engine.trajectory_2d(dt=dt)
+
+            def on_done(results):
+                if "error" not in results:
+                    results = SimulationResult.from_dict(results)
+                    self.simulation_data = results
+                    self.status_var.set(
+                        f"2D trajectory complete — apogee {results['max_altitude']:.0f} m, "
+                        f"downrange {results['max_downrange']:.0f} m")
+                    self.show_earth_trajectory()
+                else:
+                    self.status_var.set("2D trajectory simulation failed")
+                    messagebox.showerror("Error", results["error"])
+
+            self.run_in_background(work, on_done, "Running 2D trajectory simulation...")
+        except Exception as e:
+            messagebox.showerror("Error", f"2D trajectory simulation failed: {str(e)}")
+
     def run_orbital_analysis(self):
         if not self.simulation_data:
             messagebox.showwarning("Warning", "Run a simulation first")
             return
         
         try:
-            max_altitude_idx = self.simulation_data["altitude"].index(max(self.simulation_data["altitude"]))
+            max_altitude_idx = int(np.argmax(np.asarray(self.simulation_data["altitude"])))
             altitude = float(self.simulation_data["altitude"][max_altitude_idx])
             velocity = float(self.simulation_data["velocity"][max_altitude_idx])
             
@@ -1228,29 +1555,57 @@ class FlarePieApp:
             return
         
         try:
-            max_velocity_idx = self.simulation_data["velocity"].index(max(self.simulation_data["velocity"]))
+            max_velocity_idx = int(np.argmax(np.asarray(self.simulation_data["velocity"])))
             velocity = float(self.simulation_data["velocity"][max_velocity_idx])
             altitude = float(self.simulation_data["altitude"][max_velocity_idx])
-            
-            thermal_results = self.thermal_analysis.calculate_heat_transfer(
-                velocity, altitude, "aluminum", 0.01
-            )
-            
+
+            times = list(self.simulation_data["time"])
+            velocities = list(self.simulation_data["velocity"])
+            altitudes = list(self.simulation_data["altitude"])
+
+            def work(cancel_event):
+                steady = self.thermal_analysis.calculate_heat_transfer(
+                    velocity, altitude, "aluminum", 0.01
+                )
+                transient = self.thermal_analysis.transient_wall_analysis(
+                    times, velocities, altitudes, "aluminum", 0.01
+                )
+                return steady, transient
+
+            def on_done(outcome):
+                thermal_results, transient_results = outcome
+                self.status_var.set("Thermal analysis complete")
+                self._show_thermal_results(velocity, altitude, thermal_results, transient_results)
+
+            self.run_in_background(work, on_done, "Running thermal analysis...")
+        except Exception as e:
+            messagebox.showerror("Error", f"Thermal analysis failed: {str(e)}")
+
+    def _show_thermal_results(self, velocity, altitude, thermal_results, transient_results=None):
+        try:
             analysis_text = f"""
             Thermal Analysis Results:
-            
+
             Maximum Velocity: {velocity:.2f} m/s
             Altitude at Max Velocity: {altitude:.2f} m
-            
+
             Heat Transfer:
             • Convective Heat: {thermal_results['convective_heat']:.2f} W/m²
             • Radiative Heat: {thermal_results['radiative_heat']:.2f} W/m²
             • Total Heat Flux: {thermal_results['total_heat']:.2f} W/m²
             • Temperature Rise: {thermal_results['temperature_rise']:.2f} K
-            
+
             Material: {thermal_results['material']}
             """
-            
+
+            if transient_results is not None and "error" not in transient_results:
+                analysis_text += f"""
+            Transient Wall Analysis:
+            • Peak Surface Temperature: {transient_results['peak_surface_temperature']:.2f} K
+            • Peak Inner Temperature: {transient_results['peak_inner_temperature']:.2f} K
+            • Wall Thickness: {transient_results['thickness'] * 1000:.1f} mm ({transient_results['nodes']} nodes)
+            """
+
             messagebox.showinfo("Thermal Analysis", analysis_text)
         except Exception as e:
             messagebox.showerror("Error", f"Thermal analysis failed: {str(e)}")
@@ -1259,6 +1614,7 @@ class FlarePieApp:
         if not self.simulation_data:
             messagebox.showwarning("Warning", "No simulation data available")
             return
+        _ensure_plotting()
         win = tk.Toplevel(self.root)
         win.title("3D Trajectory Visualization")
         try:
@@ -1267,14 +1623,19 @@ class FlarePieApp:
             pass
         fig = Figure(figsize=(8, 6))
         ax = fig.add_subplot(111, projection='3d')
-        time_data = self.simulation_data['time']
+        if 'downrange' in self.simulation_data:
+            time_data = self.simulation_data['downrange']
+            x_label = 'Downrange (m)'
+        else:
+            time_data = self.simulation_data['time']
+            x_label = 'Time (s)'
         altitude_data = self.simulation_data['altitude']
         velocity_data = self.simulation_data['velocity']
         line, = ax.plot([], [], [], color='cyan', linewidth=2)
-        ax.set_xlabel('Time (s)')
+        ax.set_xlabel(x_label)
         ax.set_ylabel('Velocity (m/s)')
         ax.set_zlabel('Altitude (m)')  # type: ignore[attr-defined]
-        ax.set_title('3D Trajectory (Time, Velocity, Altitude)')
+        ax.set_title(f'3D Trajectory ({x_label.split(" (")[0]}, Velocity, Altitude)')
         ax.grid(True)
         ax.set_xlim(float(min(time_data)), float(max(time_data)))
         ax.set_ylim(float(min(velocity_data)), float(max(velocity_data)))
@@ -1291,17 +1652,43 @@ class FlarePieApp:
         canvas.draw()
 
     def show_performance_dashboard(self):
-        if not self.simulation_data:
-            messagebox.showwarning("Warning", "No simulation data available")
-            return
-        
+        from profiling import get_profiler
+        profiler = get_profiler()
+
         dash_win = tk.Toplevel(self.root)
         dash_win.title("Performance Dashboard")
         try:
             dash_win.iconbitmap(self.get_icon_path())
         except Exception:
             pass
-        tk.Label(dash_win, text="Performance dashboard not implemented yet").pack(padx=20, pady=20)
+
+        columns = ("section", "calls", "total", "mean", "last")
+        tree = ttk.Treeview(dash_win, columns=columns, show='headings', height=16)
+        tree.heading("section", text="Section")
+        tree.heading("calls", text="Calls")
+        tree.heading("total", text="Total (s)")
+        tree.heading("mean", text="Mean (ms)")
+        tree.heading("last", text="Last (ms)")
+        tree.column("section", width=260, anchor='w')
+        for col in columns[1:]:
+            tree.column(col, width=90, anchor='e')
+        tree.pack(fill=tk.BOTH, expand=True, padx=10, pady=10)
+
+        def refresh():
+            if not dash_win.winfo_exists():
+                return
+            tree.delete(*tree.get_children())
+            for row in profiler.snapshot():
+                tree.insert('', tk.END, values=(
+                    row["section"], row["calls"], f"{row['total_s']:.3f}",
+                    f"{row['mean_ms']:.3f}", f"{row['last_ms']:.3f}"))
+            dash_win.after(1000, refresh)
+
+        button_frame = ttk.Frame(dash_win)
+        button_frame.pack(fill=tk.X, padx=10, pady=(0, 10))
+        ttk.Button(button_frame, text="Reset Counters", command=profiler.reset).pack(side=tk.LEFT)
+
+        refresh()
 
     def show_mission_timeline(self):
         """Show mission timeline"""
@@ -1331,10 +1718,14 @@ class FlarePieApp:
         R_earth = 6371000  # meters
         lat0 = np.radians(28.3922)
         lon0 = np.radians(-80.6077)
-        alt = np.array(self.simulation_data['altitude'])
-        time = np.array(self.simulation_data['time'])
+        alt = np.asarray(self.simulation_data['altitude'])
+        time = np.asarray(self.simulation_data['time'])
         lat = np.full_like(alt, lat0)
-        lon = np.full_like(alt, lon0)
+        if 'downrange' in self.simulation_data:
+            # Lay the downrange track out eastward along the launch parallel
+            lon = lon0 + np.asarray(self.simulation_data['downrange']) / (R_earth * np.cos(lat0))
+        else:
+            lon = np.full_like(alt, lon0)
         x = (R_earth + alt) * np.cos(lat) * np.cos(lon)
         y = (R_earth + alt) * np.cos(lat) * np.sin(lon)
         z = (R_earth + alt) * np.sin(lat)
@@ -1440,6 +1831,119 @@ class FlarePieApp:
             pass
         tk.Label(about_win, text=about_text, justify='left', font=("Helvetica", 10)).pack(padx=20, pady=20)
 
+    def run_monte_carlo_analysis(self):
+        import matplotlib.pyplot as plt
+        from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg
+        from monte_carlo import MonteCarloStudy
+
+        win = tk.Toplevel(self.root)
+        win.title("Monte Carlo Dispersion Analysis")
+        try:
+            win.iconbitmap(self.get_icon_path())
+        except Exception:
+            pass
+
+        param_frame = ttk.Frame(win)
+        param_frame.pack(side=tk.LEFT, fill=tk.Y, padx=10, pady=10)
+        ttk.Label(param_frame, text="Samples:").grid(row=0, column=0, sticky='w')
+        samples_var = tk.StringVar(value="500")
+        ttk.Entry(param_frame, textvariable=samples_var, width=10).grid(row=0, column=1)
+        ttk.Label(param_frame, text="Mass Std (%):").grid(row=1, column=0, sticky='w')
+        mass_std_var = tk.StringVar(value="2.0")
+        ttk.Entry(param_frame, textvariable=mass_std_var, width=10).grid(row=1, column=1)
+        ttk.Label(param_frame, text="Thrust Std (%):").grid(row=2, column=0, sticky='w')
+        thrust_std_var = tk.StringVar(value="3.0")
+        ttk.Entry(param_frame, textvariable=thrust_std_var, width=10).grid(row=2, column=1)
+        ttk.Label(param_frame, text="Flow Rate Std (%):").grid(row=3, column=0, sticky='w')
+        mfr_std_var = tk.StringVar(value="2.0")
+        ttk.Entry(param_frame, textvariable=mfr_std_var, width=10).grid(row=3, column=1)
+
+        stats_frame = ttk.LabelFrame(param_frame, text="Dispersion Statistics")
+        stats_frame.grid(row=5, column=0, columnspan=2, sticky='ew', pady=10)
+        stats_text = tk.StringVar(value="")
+        ttk.Label(stats_frame, textvariable=stats_text, justify='left').pack(anchor='w', padx=5, pady=5)
+
+        plot_frame = ttk.Frame(win)
+        plot_frame.pack(side=tk.RIGHT, fill=tk.BOTH, expand=True, padx=10, pady=10)
+        fig, (ax_fan, ax_hist) = plt.subplots(2, 1, figsize=(7, 6))
+        canvas = FigureCanvasTkAgg(fig, master=plot_frame)
+        canvas.get_tk_widget().pack(fill=tk.BOTH, expand=True)
+
+        def run_study():
+            try:
+                samples = int(samples_var.get())
+                mass_std = float(mass_std_var.get()) / 100.0
+                thrust_std = float(thrust_std_var.get()) / 100.0
+                mfr_std = float(mfr_std_var.get()) / 100.0
+
+                intmass = float(self.rocket_vars["intmass"].get())
+                propmass = float(self.rocket_vars["propmass"].get())
+                ct = float(self.rocket_vars["ct"].get())
+                mfr = float(self.nozzle_vars["mfr"].get()) if "mfr" in self.nozzle_vars else float(self.rocket_vars["mfr"].get())
+
+                base_config = {
+                    "fuel_type": self.rocket_vars["fuel_type"].get(),
+                    "cocp": float(self.rocket_vars["cocp"].get()),
+                    "ct": ct,
+                    "altitude": float(self.rocket_vars["altitude"].get()),
+                    "intmass": intmass,
+                    "propmass": propmass,
+                    "mfr": mfr,
+                    "dt": float(self.rocket_vars["dt"].get()),
+                    "reference_area": float(self.rocket_vars["reference_area"].get())
+                }
+                dispersions = {
+                    "intmass": {"dist": "normal", "mean": intmass, "std": intmass * mass_std},
+                    "ct": {"dist": "normal", "mean": ct, "std": ct * thrust_std},
+                    "mfr": {"dist": "normal", "mean": mfr, "std": mfr * mfr_std}
+                }
+            except ValueError:
+                messagebox.showerror("Input Error", "Please enter valid numeric values")
+                return
+
+            study = MonteCarloStudy(base_config, dispersions, samples=samples,
+                                    trajectory_points=200)
+
+            def work(cancel_event):
+                study.run()
+                return study
+
+            def on_done(study):
+                grid, bands = study.percentile_fan("altitude")
+                stats = study.summary_statistics()
+
+                ax_fan.clear()
+                ax_fan.fill_between(grid, bands[5], bands[95], color='tab:blue', alpha=0.2, label='5-95%')
+                ax_fan.fill_between(grid, bands[25], bands[75], color='tab:blue', alpha=0.4, label='25-75%')
+                ax_fan.plot(grid, bands[50], color='tab:blue', lw=1.5, label='Median')
+                ax_fan.set_xlabel('Time (s)')
+                ax_fan.set_ylabel('Altitude (m)')
+                ax_fan.set_title(f'Altitude Dispersion ({samples} cases)')
+                ax_fan.legend(fontsize=8)
+                ax_fan.grid(True, alpha=0.3)
+
+                apogees = study.channel_arrays()["max_altitude"]
+                apogees = apogees[np.isfinite(apogees)]
+                ax_hist.clear()
+                ax_hist.hist(apogees, bins=40, color='tab:orange', alpha=0.7)
+                ax_hist.set_xlabel('Apogee (m)')
+                ax_hist.set_ylabel('Cases')
+                ax_hist.grid(True, alpha=0.3)
+                fig.tight_layout()
+                canvas.draw()
+
+                lines = []
+                for name in ("max_altitude", "max_velocity", "delta_v"):
+                    if name in stats:
+                        s = stats[name]
+                        lines.append(f"{name}: mean {s['mean']:.1f}, std {s['std']:.1f}, "
+                                     f"p5 {s['p5']:.1f}, p95 {s['p95']:.1f}")
+                stats_text.set("\n".join(lines))
+
+            self.run_in_background(work, on_done, description=f"Running {samples} dispersion cases...")
+
+        ttk.Button(param_frame, text="Run Analysis", command=run_study).grid(row=4, column=0, columnspan=2, pady=10)
+
     def open_nozzle_designer(self):
         import matplotlib.pyplot as plt
         from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg
@@ -1509,6 +2013,54 @@ class FlarePieApp:
                 material_var.set(design.get("material", "Steel"))
         ttk.Button(param_frame, text="Save Design", command=save_design).grid(row=7, column=0, pady=5)
         ttk.Button(param_frame, text="Load Design", command=load_design).grid(row=7, column=1, pady=5)
+        def open_sweep():
+            from Engine import nozzle_design_grid
+            try:
+                throat_r = float(throat_r_var.get())
+            except ValueError:
+                messagebox.showerror("Input Error", "Invalid throat radius")
+                return
+            area_throat = 3.14159 * throat_r**2
+            exit_areas = np.linspace(area_throat * 1.5, area_throat * 40, 200)
+            chamber_pressures = np.linspace(1e6, 2e7, 200)
+            grid = nozzle_design_grid(exit_areas, chamber_pressures, throat_area=area_throat)
+
+            sweep_win = tk.Toplevel(win)
+            sweep_win.title("Nozzle Design Space Sweep")
+            metric_var = tk.StringVar(value="ISP (s)")
+            metrics = {
+                "Thrust (kN)": grid["thrust"] / 1000.0,
+                "ISP (s)": grid["isp"],
+                "Efficiency": grid["efficiency"]
+            }
+            top = ttk.Frame(sweep_win)
+            top.pack(side=tk.TOP, fill=tk.X, padx=10, pady=5)
+            ttk.Label(top, text="Metric:").pack(side=tk.LEFT)
+            metric_menu = ttk.Combobox(top, textvariable=metric_var, values=list(metrics.keys()), state="readonly", width=12)
+            metric_menu.pack(side=tk.LEFT, padx=5)
+            sweep_fig, sweep_ax = plt.subplots(figsize=(6, 5))
+            sweep_canvas = FigureCanvasTkAgg(sweep_fig, master=sweep_win)
+            sweep_canvas.get_tk_widget().pack(fill=tk.BOTH, expand=True, padx=10, pady=10)
+            def draw_sweep(*args):
+                values = metrics[metric_var.get()]
+                sweep_ax.clear()
+                mesh = sweep_ax.pcolormesh(grid["chamber_pressures"] / 1e6, grid["exit_areas"],
+                                           values, shading='auto', cmap='viridis')
+                best = np.unravel_index(np.nanargmax(values), values.shape)
+                sweep_ax.plot(grid["chamber_pressures"][best[1]] / 1e6, grid["exit_areas"][best[0]],
+                              'w*', markersize=14, markeredgecolor='black')
+                sweep_ax.set_xlabel('Chamber Pressure (MPa)')
+                sweep_ax.set_ylabel('Exit Area (m²)')
+                sweep_ax.set_title(f"{metric_var.get()} — optimum: Pc {grid['chamber_pressures'][best[1]]/1e6:.1f} MPa, "
+                                   f"Ae {grid['exit_areas'][best[0]]:.3f} m²")
+                if not hasattr(draw_sweep, 'cbar'):
+                    draw_sweep.cbar = sweep_fig.colorbar(mesh, ax=sweep_ax)
+                else:
+                    draw_sweep.cbar.update_normal(mesh)
+                sweep_canvas.draw()
+            metric_menu.bind('<<ComboboxSelected>>', draw_sweep)
+            draw_sweep()
+        ttk.Button(param_frame, text="Sweep Design Space", command=open_sweep).grid(row=8, column=0, columnspan=2, pady=5)
         metrics_frame = ttk.LabelFrame(win, text="Performance Metrics")
         metrics_frame.pack(side=tk.TOP, fill=tk.X, padx=10, pady=10)
         metrics_text = tk.StringVar(value="")
@@ -1,10 +1,16 @@
+import heapq
+import json
 import math
+import os
+import time
 import numpy as np
 from typing import Dict, List, Tuple, Optional
 from dataclasses import dataclass
 from datetime import datetime
 import logging
 from Engine import rocket_simulation, nozzle_performance, get_atmospheric_pressure
+from drag_model import get_drag_model
+from profiling import get_profiler
 
 @dataclass
 class Stage:
@@ -22,6 +28,23 @@ class Stage:
     fairing_mass: float = 0.0
     fairing_separation_altitude: Optional[float] = None
 
+@dataclass
+class GravityTurnProfile:
+    """Piecewise pitch program: vertical until kick_altitude, then a
+    linear-in-altitude turn down to final_pitch_deg above the horizon."""
+
+    kick_altitude: float = 1000.0
+    turn_end_altitude: float = 40000.0
+    final_pitch_deg: float = 10.0
+
+    def pitch(self, altitude: float) -> float:
+        if altitude <= self.kick_altitude:
+            return math.pi / 2
+        if altitude >= self.turn_end_altitude:
+            return math.radians(self.final_pitch_deg)
+        frac = (altitude - self.kick_altitude) / (self.turn_end_altitude - self.kick_altitude)
+        return math.radians(90.0 + (self.final_pitch_deg - 90.0) * frac)
+
 @dataclass
 class OrbitalParameters:
     semi_major_axis: float
@@ -42,10 +65,25 @@ class AdvancedRocketEngine:
     def add_stage(self, stage: Stage):
         self.stages.append(stage)
     
-    def multi_stage_simulation(self, dt: float = 0.1, max_time: Optional[float] = None) -> Dict:
+    def multi_stage_simulation(self, dt: float = 0.1, max_time: Optional[float] = None,
+                               adaptive: bool = False, tolerance: float = 1e-3,
+                               max_dt: float = 1.0, checkpoint_dir: Optional[str] = None,
+                               checkpoint_interval: float = 10.0,
+                               resume_from: Optional[str] = None) -> Dict:
+        """Multi-stage ascent simulation with optional checkpointing.
+
+        When checkpoint_dir is set, the compact flight state (mass,
+        velocity, altitude, per-stage propellant, current_stage, events)
+        is written to checkpoint_latest.json every checkpoint_interval
+        simulated seconds, and a separate checkpoint is kept at every
+        staging event so branch studies can replay from a separation
+        instead of re-flying the boost. resume_from restores state from
+        such a file; the returned series then cover the flight from the
+        checkpoint onward.
+        """
         if not self.stages:
             return {"error": "No stages defined"}
-        
+
         time_data = []
         altitude_data = []
         velocity_data = []
@@ -53,72 +91,90 @@ class AdvancedRocketEngine:
         thrust_data = []
         stage_data = []
         events = []
-        
+
         current_time = 0.0
         current_altitude = 0.0
         current_velocity = 0.0
         current_mass = sum(stage.total_mass for stage in self.stages)
-        
+
         stage_masses = [stage.total_mass for stage in self.stages]
         stage_propellants = [stage.propellant_mass for stage in self.stages]
         stage_flow_rates = [stage.mass_flow_rate for stage in self.stages]
-        
+
+        dt_step = dt
+
+        if resume_from:
+            state = self.load_checkpoint(resume_from)
+            current_time = state["time"]
+            current_altitude = state["altitude"]
+            current_velocity = state["velocity"]
+            current_mass = state["mass"]
+            self.current_stage = state["current_stage"]
+            stage_propellants = list(state["stage_propellants"])
+            for stage, fairing_mass in zip(self.stages, state["fairing_masses"]):
+                stage.fairing_mass = fairing_mass
+            events = list(state["events"])
+            dt_step = state.get("dt_step", dt)
+
+        if checkpoint_dir:
+            os.makedirs(checkpoint_dir, exist_ok=True)
+        next_checkpoint = current_time + checkpoint_interval
+        events_checkpointed = len(events)
+
+        profiler = get_profiler()
+        loop_slot = profiler.section("engine.multi_stage_simulation")
+        loop_started = time.perf_counter()
+
+        # Time-based staging events (separation_time, depletion computed
+        # from remaining propellant / mass flow) live in a priority queue,
+        # so the integrator runs uninterrupted bulk segments between
+        # events instead of re-checking every condition on every step.
+        # Altitude-triggered events are caught by bracketing the step
+        # that crosses the threshold and bisecting inside it, which also
+        # makes event timing sub-step accurate.
+        event_queue = []
+        event_seq = 0
+
+        def schedule_stage_events(stage_index):
+            nonlocal event_seq
+            stage = self.stages[stage_index]
+            if stage_propellants[stage_index] <= 0:
+                # Stage is already dry (zero propellant_mass, or a resumed
+                # checkpoint past burnout): deplete it immediately rather
+                # than burning forever on phantom thrust.
+                heapq.heappush(event_queue, (current_time, event_seq, "stage_depletion", stage_index))
+                event_seq += 1
+            elif stage_flow_rates[stage_index] > 0:
+                depletion_time = current_time + stage_propellants[stage_index] / stage_flow_rates[stage_index]
+                heapq.heappush(event_queue, (depletion_time, event_seq, "stage_depletion", stage_index))
+                event_seq += 1
+            if stage.separation_time is not None and stage.separation_time > current_time:
+                heapq.heappush(event_queue, (stage.separation_time, event_seq, "stage_separation", stage_index))
+                event_seq += 1
+
+        if self.current_stage < len(self.stages):
+            schedule_stage_events(self.current_stage)
+
         while current_time < (max_time or float('inf')):
-            if self.current_stage < len(self.stages):
-                stage = self.stages[self.current_stage]
-                
-                if (stage.separation_altitude and current_altitude >= stage.separation_altitude) or \
-                   (stage.separation_time and current_time >= stage.separation_time):
-                    events.append({
-                        "time": current_time,
-                        "type": "stage_separation",
-                        "stage": self.current_stage,
-                        "altitude": current_altitude,
-                        "velocity": current_velocity
-                    })
-                    self.current_stage += 1
-                    continue
-            
-            if self.current_stage < len(self.stages):
-                stage = self.stages[self.current_stage]
-                if (stage.fairing_separation_altitude and 
-                    current_altitude >= stage.fairing_separation_altitude and
-                    stage.fairing_mass > 0):
-                    events.append({
-                        "time": current_time,
-                        "type": "fairing_separation",
-                        "stage": self.current_stage,
-                        "altitude": current_altitude,
-                        "mass_jettisoned": stage.fairing_mass
-                    })
-                    current_mass -= stage.fairing_mass
-                    stage.fairing_mass = 0
-            
-            if self.current_stage < len(self.stages):
-                stage = self.stages[self.current_stage]
-                
-                ap = get_atmospheric_pressure(current_altitude)
-                k, R = self._get_fuel_properties(stage.fuel_type)
-                pressure_ratio = (ap / stage.chamber_pressure) ** ((k - 1) / k) if stage.chamber_pressure > 0 else 0.0
-                ve = math.sqrt((2.0 * k) / (k - 1.0) * R * stage.combustion_temp * (1.0 - pressure_ratio))
-                thrust = stage_flow_rates[self.current_stage] * ve
-                
-                mass_used = min(stage_flow_rates[self.current_stage] * dt, stage_propellants[self.current_stage])
-                stage_propellants[self.current_stage] -= mass_used
-                current_mass -= mass_used
-                
-                if stage_propellants[self.current_stage] <= 0:
-                    events.append({
-                        "time": current_time,
-                        "type": "stage_depletion",
-                        "stage": self.current_stage,
-                        "altitude": current_altitude,
-                        "velocity": current_velocity
-                    })
-                    self.current_stage += 1
-                    continue
-            else:
-                thrust = 0
+            if checkpoint_dir:
+                while events_checkpointed < len(events):
+                    event = events[events_checkpointed]
+                    name = f"checkpoint_{event['type']}_{event.get('stage', 0)}.json"
+                    self.save_checkpoint(
+                        os.path.join(checkpoint_dir, name),
+                        self._checkpoint_state(current_time, current_velocity,
+                                               current_altitude, current_mass,
+                                               stage_propellants, dt_step, events))
+                    events_checkpointed += 1
+                if current_time >= next_checkpoint:
+                    self.save_checkpoint(
+                        os.path.join(checkpoint_dir, "checkpoint_latest.json"),
+                        self._checkpoint_state(current_time, current_velocity,
+                                               current_altitude, current_mass,
+                                               stage_propellants, dt_step, events))
+                    next_checkpoint = current_time + checkpoint_interval
+
+            if self.current_stage >= len(self.stages):
                 events.append({
                     "time": current_time,
                     "type": "mission_complete",
@@ -126,26 +182,123 @@ class AdvancedRocketEngine:
                     "velocity": current_velocity
                 })
                 break
-            
-            drag = self._calculate_drag(current_velocity, current_altitude,
-                                      self.stages[self.current_stage].reference_area)
-            acceleration = (thrust / current_mass) - 9.81 - (drag / current_mass)
-            
-            velocity_new, altitude_new = self._rk4_integration(
-                current_velocity, current_altitude, acceleration, dt
-            )
-            
-            time_data.append(current_time)
-            altitude_data.append(current_altitude)
-            velocity_data.append(current_velocity)
-            mass_data.append(current_mass)
-            thrust_data.append(thrust)
-            stage_data.append(self.current_stage)
-            
-            current_velocity = velocity_new
-            current_altitude = altitude_new
-            current_time += dt
-        
+
+            while event_queue and event_queue[0][3] < self.current_stage:
+                heapq.heappop(event_queue)
+
+            segment_end = event_queue[0][0] if event_queue else float('inf')
+            if max_time is not None:
+                segment_end = min(segment_end, max_time)
+
+            if current_time >= segment_end - 1e-9 and event_queue:
+                event_time, _, kind, stage_index = heapq.heappop(event_queue)
+                events.append({
+                    "time": event_time,
+                    "type": kind,
+                    "stage": stage_index,
+                    "altitude": current_altitude,
+                    "velocity": current_velocity
+                })
+                self.current_stage += 1
+                if self.current_stage < len(self.stages):
+                    schedule_stage_events(self.current_stage)
+                continue
+
+            stage = self.stages[self.current_stage]
+            k, R = self._get_fuel_properties(stage.fuel_type)
+            separation_altitude = stage.separation_altitude
+            fairing_altitude = stage.fairing_separation_altitude if stage.fairing_mass > 0 else None
+
+            while current_time < segment_end - 1e-9:
+                step_dt = min(dt_step, segment_end - current_time)
+
+                ap = get_atmospheric_pressure(current_altitude)
+                pressure_ratio = (ap / stage.chamber_pressure) ** ((k - 1) / k) if stage.chamber_pressure > 0 else 0.0
+                ve = math.sqrt((2.0 * k) / (k - 1.0) * R * stage.combustion_temp * (1.0 - pressure_ratio))
+                thrust = stage_flow_rates[self.current_stage] * ve
+
+                def flight_derivative(v, h, thrust=thrust, mass=current_mass, area=stage.reference_area):
+                    return self._flight_derivative(v, h, thrust, mass, area)
+
+                velocity_new, altitude_new = self._rk4_integration(
+                    current_velocity, current_altitude, flight_derivative, step_dt
+                )
+
+                dt_next = dt_step
+                if adaptive:
+                    # Step doubling: the error between one full step and two
+                    # half steps adjusts the size of the NEXT step, so the
+                    # mass depletion always matches the step actually taken.
+                    v_half, h_half = self._rk4_integration(
+                        current_velocity, current_altitude, flight_derivative, step_dt * 0.5)
+                    v_two, h_two = self._rk4_integration(
+                        v_half, h_half, flight_derivative, step_dt * 0.5)
+
+                    error = abs(velocity_new - v_two) + abs(altitude_new - h_two) / max(abs(h_two), 1.0)
+                    velocity_new, altitude_new = v_two, h_two
+                    if error > 0:
+                        dt_next = dt_step * min(0.9 * (tolerance / error) ** (1.0 / 5.0), 5.0)
+                    else:
+                        dt_next = max_dt
+
+                crossing = None
+                if separation_altitude is not None and current_altitude < separation_altitude <= altitude_new:
+                    crossing = ("stage_separation", separation_altitude)
+                elif fairing_altitude is not None and current_altitude < fairing_altitude <= altitude_new:
+                    crossing = ("fairing_separation", fairing_altitude)
+
+                if crossing is not None:
+                    step_dt = self._bisect_altitude_crossing(
+                        current_velocity, current_altitude, flight_derivative,
+                        step_dt, crossing[1])
+                    velocity_new, altitude_new = self._rk4_integration(
+                        current_velocity, current_altitude, flight_derivative, step_dt)
+
+                mass_used = min(stage_flow_rates[self.current_stage] * step_dt, stage_propellants[self.current_stage])
+                stage_propellants[self.current_stage] -= mass_used
+                current_mass -= mass_used
+
+                time_data.append(current_time)
+                altitude_data.append(current_altitude)
+                velocity_data.append(current_velocity)
+                mass_data.append(current_mass)
+                thrust_data.append(thrust)
+                stage_data.append(self.current_stage)
+
+                current_velocity = velocity_new
+                current_altitude = altitude_new
+                current_time += step_dt
+
+                if adaptive:
+                    dt_step = min(max(dt_next, dt), max_dt)
+
+                if crossing is not None:
+                    if crossing[0] == "fairing_separation":
+                        events.append({
+                            "time": current_time,
+                            "type": "fairing_separation",
+                            "stage": self.current_stage,
+                            "altitude": current_altitude,
+                            "mass_jettisoned": stage.fairing_mass
+                        })
+                        current_mass -= stage.fairing_mass
+                        stage.fairing_mass = 0
+                        fairing_altitude = None
+                    else:
+                        events.append({
+                            "time": current_time,
+                            "type": "stage_separation",
+                            "stage": self.current_stage,
+                            "altitude": current_altitude,
+                            "velocity": current_velocity
+                        })
+                        self.current_stage += 1
+                        if self.current_stage < len(self.stages):
+                            schedule_stage_events(self.current_stage)
+                        break
+
+        profiler.record(loop_slot, loop_started)
+
         return {
             "time": time_data,
             "altitude": altitude_data,
@@ -159,6 +312,198 @@ class AdvancedRocketEngine:
             "max_velocity": max(velocity_data) if velocity_data else 0
         }
     
+    def trajectory_2d(self, dt: float = 0.1, pitch_profile: Optional["GravityTurnProfile"] = None,
+                      coast_time: float = 300.0) -> Dict:
+        """2D (downrange/altitude) ascent with a gravity-turn pitch profile.
+
+        State lives in preallocated structure-of-arrays storage — position
+        (N, 2), velocity (N, 2), mass (N,) — filled in place, and stage
+        burns are laid out up front as indexed episodes (start step, step
+        count, separation) instead of per-step if chains, so the inner
+        loop only does arithmetic. The returned series are the arrays
+        themselves (sliced to the flown steps), ready for the trajectory
+        views without any list conversion.
+        """
+        if not self.stages:
+            return {"error": "No stages defined"}
+        if pitch_profile is None:
+            pitch_profile = GravityTurnProfile()
+        drag_model = get_drag_model()
+
+        episodes = []
+        start_step = 0
+        episode_start_time = 0.0
+        for i, stage in enumerate(self.stages):
+            if stage.mass_flow_rate > 0:
+                burn_time = stage.propellant_mass / stage.mass_flow_rate
+            else:
+                burn_time = 0.0
+            if stage.separation_time is not None:
+                burn_time = min(burn_time, max(stage.separation_time - episode_start_time, 0.0))
+            n_steps = max(int(burn_time / dt), 1)
+            episodes.append({"stage": i, "start_step": start_step, "n_steps": n_steps})
+            start_step += n_steps
+            episode_start_time += n_steps * dt
+
+        coast_steps = int(coast_time / dt)
+        n_total = start_step + coast_steps
+
+        time = np.arange(n_total + 1) * dt
+        position = np.zeros((n_total + 1, 2))
+        velocity = np.zeros((n_total + 1, 2))
+        mass = np.zeros(n_total + 1)
+        thrust_data = np.zeros(n_total + 1)
+        pitch_data = np.zeros(n_total + 1)
+        stage_data = np.full(n_total + 1, -1, dtype=np.int64)
+
+        mass[0] = sum(stage.total_mass for stage in self.stages)
+        events = []
+        step = 0
+
+        for episode in episodes:
+            stage = self.stages[episode["stage"]]
+            k, R = self._get_fuel_properties(stage.fuel_type)
+            mfr = stage.mass_flow_rate
+            area = stage.reference_area
+            fairing_pending = (stage.fairing_mass > 0 and
+                               stage.fairing_separation_altitude is not None)
+
+            for _ in range(episode["n_steps"]):
+                x, h = position[step]
+                vx, vy = velocity[step]
+                m = mass[step]
+
+                if fairing_pending and h >= stage.fairing_separation_altitude:
+                    events.append({"time": time[step], "type": "fairing_separation",
+                                   "stage": episode["stage"], "step": step,
+                                   "altitude": h, "mass_jettisoned": stage.fairing_mass})
+                    m -= stage.fairing_mass
+                    fairing_pending = False
+
+                ap = get_atmospheric_pressure(h)
+                pressure_ratio = (ap / stage.chamber_pressure) ** ((k - 1) / k) if stage.chamber_pressure > 0 else 0.0
+                ve = math.sqrt((2.0 * k) / (k - 1.0) * R * stage.combustion_temp * (1.0 - pressure_ratio))
+                thrust = mfr * ve
+                pitch = pitch_profile.pitch(h)
+
+                ax = thrust * math.cos(pitch) / m
+                ay = thrust * math.sin(pitch) / m - 9.81
+                speed = math.hypot(vx, vy)
+                if speed > 0:
+                    drag = drag_model.drag(speed, h, area)
+                    ax -= drag / m * vx / speed
+                    ay -= drag / m * vy / speed
+
+                vx += ax * dt
+                vy += ay * dt
+                step += 1
+                position[step, 0] = x + vx * dt
+                position[step, 1] = h + vy * dt
+                velocity[step, 0] = vx
+                velocity[step, 1] = vy
+                mass[step] = m - mfr * dt
+                thrust_data[step] = thrust
+                pitch_data[step] = pitch
+                stage_data[step] = episode["stage"]
+
+            # The last stage burns out but is never separated: its dry
+            # mass rides through the coast, otherwise the vehicle mass
+            # hits zero and the drag/m terms blow up to NaN.
+            if episode["stage"] < len(self.stages) - 1:
+                events.append({"time": time[step], "type": "stage_separation",
+                               "stage": episode["stage"], "step": step,
+                               "altitude": float(position[step, 1]),
+                               "velocity": float(math.hypot(*velocity[step]))})
+                burned = mfr * episode["n_steps"] * dt
+                mass[step] -= max(stage.total_mass - burned, 0.0)
+
+        for _ in range(coast_steps):
+            x, h = position[step]
+            vx, vy = velocity[step]
+            m = mass[step]
+            ax = 0.0
+            ay = -9.81
+            speed = math.hypot(vx, vy)
+            if speed > 0:
+                drag = drag_model.drag(speed, h, self.stages[-1].reference_area)
+                ax -= drag / m * vx / speed
+                ay -= drag / m * vy / speed
+            vx += ax * dt
+            vy += ay * dt
+            step += 1
+            position[step, 0] = x + vx * dt
+            position[step, 1] = h + vy * dt
+            velocity[step, 0] = vx
+            velocity[step, 1] = vy
+            mass[step] = m
+            if position[step, 1] <= 0:
+                events.append({"time": time[step], "type": "impact", "step": step,
+                               "downrange": float(position[step, 0])})
+                break
+
+        n = step + 1
+        return {
+            "time": time[:n],
+            "downrange": position[:n, 0],
+            "altitude": position[:n, 1],
+            "vx": velocity[:n, 0],
+            "vy": velocity[:n, 1],
+            "velocity": np.hypot(velocity[:n, 0], velocity[:n, 1]),
+            "mass": mass[:n],
+            "thrust": thrust_data[:n],
+            "pitch": pitch_data[:n],
+            "stage": stage_data[:n],
+            "events": events,
+            "final_time": float(time[n - 1]),
+            "max_altitude": float(np.max(position[:n, 1])),
+            "max_downrange": float(np.max(position[:n, 0]))
+        }
+
+    def _bisect_altitude_crossing(self, velocity: float, altitude: float, derivative,
+                                  dt_step: float, threshold: float,
+                                  iterations: int = 24) -> float:
+        """Find where a step crosses an altitude threshold.
+
+        The caller has already bracketed the crossing (altitude below the
+        threshold at the step start, at or above it after dt_step);
+        bisecting the partial-step RK4 integration pins the crossing time
+        to sub-step accuracy.
+        """
+        lo, hi = 0.0, dt_step
+        for _ in range(iterations):
+            mid = 0.5 * (lo + hi)
+            _, h_mid = self._rk4_integration(velocity, altitude, derivative, mid)
+            if h_mid >= threshold:
+                hi = mid
+            else:
+                lo = mid
+        return hi
+
+    def _checkpoint_state(self, current_time: float, current_velocity: float,
+                          current_altitude: float, current_mass: float,
+                          stage_propellants: List[float], dt_step: float,
+                          events: List[Dict]) -> Dict:
+        return {
+            "time": current_time,
+            "velocity": current_velocity,
+            "altitude": current_altitude,
+            "mass": current_mass,
+            "current_stage": self.current_stage,
+            "stage_propellants": list(stage_propellants),
+            "fairing_masses": [stage.fairing_mass for stage in self.stages],
+            "dt_step": dt_step,
+            "events": events
+        }
+
+    def save_checkpoint(self, path: str, state: Dict):
+        with open(path, 'w') as f:
+            json.dump(state, f)
+
+    @staticmethod
+    def load_checkpoint(path: str) -> Dict:
+        with open(path, 'r') as f:
+            return json.load(f)
+
     def _get_fuel_properties(self, fuel_type: str) -> Tuple[float, float]:
         fuel_properties = {
             "RP1": (1.2, 287.0),
@@ -169,42 +514,29 @@ class AdvancedRocketEngine:
         return fuel_properties.get(fuel_type, (1.2, 287.0))
     
     def _calculate_drag(self, velocity: float, altitude: float, reference_area: float) -> float:
-        p0 = 1.225
-        h0 = 8500
-        density = p0 * math.exp(-altitude / h0)
-        
-        speed_of_sound = 340.0 * math.sqrt(get_atmospheric_pressure(altitude) / 101325.0)
-        mach = abs(velocity) / max(speed_of_sound, 0.1)
-        
-        if mach < 0.8:
-            cd = 0.3
-        elif mach < 1.1:
-            cd = 0.3 + (mach - 0.8) * 1.0
-        else:
-            cd = 0.6 - 0.1 * min(mach - 1.1, 0.4)
-        
-        drag = 0.5 * density * velocity ** 2 * reference_area * cd
-        return drag if velocity > 0 else -drag
+        return get_drag_model().drag(velocity, altitude, reference_area)
     
-    def _rk4_integration(self, v: float, h: float, a: float, dt: float) -> Tuple[float, float]:
+    def _flight_derivative(self, velocity: float, altitude: float, thrust: float,
+                           mass: float, reference_area: float) -> Tuple[float, float]:
+        drag = self._calculate_drag(velocity, altitude, reference_area)
+        acceleration = (thrust / mass) - 9.81 - (drag / mass)
+        return acceleration, velocity
 
-        k1_v = a * dt
-        k1_h = v * dt
-        
+    def _rk4_integration(self, v: float, h: float, derivative, dt: float) -> Tuple[float, float]:
+        """Classic fourth-order Runge-Kutta step.
 
-        k2_v = a * dt
-        k2_h = (v + 0.5 * k1_v) * dt
-        
+        derivative(v, h) must return (dv/dt, dh/dt) and is re-evaluated at
+        every sub-stage, so the drag and gravity terms respond to the
+        intermediate states instead of being frozen at the step start.
+        """
+        k1_v, k1_h = derivative(v, h)
+        k2_v, k2_h = derivative(v + 0.5 * dt * k1_v, h + 0.5 * dt * k1_h)
+        k3_v, k3_h = derivative(v + 0.5 * dt * k2_v, h + 0.5 * dt * k2_h)
+        k4_v, k4_h = derivative(v + dt * k3_v, h + dt * k3_h)
+
+        v_new = v + dt * (k1_v + 2 * k2_v + 2 * k3_v + k4_v) / 6
+        h_new = h + dt * (k1_h + 2 * k2_h + 2 * k3_h + k4_h) / 6
 
-        k3_v = a * dt
-        k3_h = (v + 0.5 * k2_v) * dt
-        
-        k4_v = a * dt
-        k4_h = (v + k3_v) * dt
-        
-        v_new = v + (k1_v + 2*k2_v + 2*k3_v + k4_v) / 6
-        h_new = h + (k1_h + 2*k2_h + 2*k3_h + k4_h) / 6
-        
         return v_new, h_new
 
 class OrbitalMechanics:
@@ -257,6 +589,69 @@ class OrbitalMechanics:
         
         return OrbitalParameters(float(a), float(e), float(i), float(w), float(omega), float(nu))
     
+    @staticmethod
+    def propagate_orbit(position: np.ndarray, velocity: np.ndarray, duration: float,
+                        dt: float = 10.0, sample_every: int = 10) -> Dict:
+        """Propagate a two-body state with the leapfrog (kick-drift-kick) scheme.
+
+        Leapfrog is symplectic, so orbital energy stays bounded over
+        thousands of revolutions instead of drifting the way a naive
+        Runge-Kutta propagation does. The state vectors advance with
+        vectorized NumPy math and every sample_every-th step is recorded,
+        so days of orbit resolve in well under a second. Returns sampled
+        time, position (N, 3) and velocity (N, 3) arrays plus the specific
+        orbital energy per sample — the position columns feed
+        show_earth_trajectory directly.
+        """
+        mu = OrbitalMechanics.G * OrbitalMechanics.M_EARTH
+        pos = np.array(position, dtype=np.float64)
+        vel = np.array(velocity, dtype=np.float64)
+
+        n_steps = max(1, int(math.ceil(duration / dt)))
+        n_samples = n_steps // sample_every + 1
+
+        times = np.empty(n_samples)
+        positions = np.empty((n_samples, 3))
+        velocities = np.empty((n_samples, 3))
+
+        r2 = pos @ pos
+        acc = -mu * pos / (r2 * math.sqrt(r2))
+
+        times[0] = 0.0
+        positions[0] = pos
+        velocities[0] = vel
+        sample = 1
+
+        for step in range(1, n_steps + 1):
+            vel += 0.5 * dt * acc
+            pos += dt * vel
+            r2 = pos @ pos
+            acc = -mu * pos / (r2 * math.sqrt(r2))
+            vel += 0.5 * dt * acc
+
+            if step % sample_every == 0 and sample < n_samples:
+                times[sample] = step * dt
+                positions[sample] = pos
+                velocities[sample] = vel
+                sample += 1
+
+        times = times[:sample]
+        positions = positions[:sample]
+        velocities = velocities[:sample]
+
+        radii = np.linalg.norm(positions, axis=1)
+        speeds = np.linalg.norm(velocities, axis=1)
+        energies = 0.5 * speeds ** 2 - mu / radii
+
+        return {
+            "time": times,
+            "position": positions,
+            "velocity": velocities,
+            "energy": energies,
+            "final_position": pos,
+            "final_velocity": vel
+        }
+
     @staticmethod
     def calculate_escape_velocity(altitude: float) -> float:
         r = OrbitalMechanics.R_EARTH + altitude
@@ -296,11 +691,105 @@ class ThermalAnalysis:
         
         properties = self.material_properties.get(material, self.material_properties["aluminum"])
         temp_rise = total_heat * thickness / (properties["thermal_conductivity"] * properties["density"] * properties["specific_heat"])
-        
+
         return {
             "convective_heat": q_conv if velocity > 0 else 0,
             "radiative_heat": q_rad if velocity > 0 else 0,
             "total_heat": total_heat,
             "temperature_rise": temp_rise,
             "material": material
-        } 
\ No newline at end of file
+        }
+
+    def transient_wall_analysis(self, times, velocities, altitudes, material: str = "aluminum",
+                                thickness: float = 0.01, nodes: int = 50,
+                                initial_temp: float = 300.0, max_steps: int = 2000) -> Dict:
+        """Transient 1D conduction through the wall over a full flight.
+
+        Backward-Euler finite differences across `nodes` points through
+        `thickness`, solved per step with the Thomas algorithm over
+        vectorized node arrays. The aerodynamic heat flux from the
+        velocity/altitude series drives the outer face; the inner face is
+        adiabatic. Input series longer than max_steps are subsampled first
+        — wall conduction evolves far slower than the flight dt, so a
+        100k-step trajectory resolves in a couple of thousand solves.
+        """
+        times = np.asarray(times, dtype=np.float64)
+        velocities = np.asarray(velocities, dtype=np.float64)
+        altitudes = np.asarray(altitudes, dtype=np.float64)
+
+        if len(times) < 2:
+            return {"error": "Need at least two trajectory samples"}
+
+        if len(times) > max_steps:
+            idx = np.linspace(0, len(times) - 1, max_steps).astype(np.intp)
+            times, velocities, altitudes = times[idx], velocities[idx], altitudes[idx]
+
+        properties = self.material_properties.get(material, self.material_properties["aluminum"])
+        conductivity = properties["thermal_conductivity"]
+        diffusivity = conductivity / (properties["density"] * properties["specific_heat"])
+
+        # Heat flux series from the same correlation as calculate_heat_transfer
+        density = 1.225 * np.exp(-np.clip(altitudes, 0.0, None) / 8500.0)
+        q_conv = 0.026 * np.abs(velocities) ** 0.8 * density ** 0.2 * velocities ** 2 / 2
+        q_rad = 5.67e-8 * 0.8 * (300 ** 4)
+        heat_flux = np.where(velocities > 0, q_conv + q_rad, 0.0)
+
+        dx = thickness / (nodes - 1)
+        temperature = np.full(nodes, initial_temp)
+
+        surface_temps = np.empty(len(times))
+        inner_temps = np.empty(len(times))
+        surface_temps[0] = inner_temps[0] = initial_temp
+
+        lower = np.empty(nodes)
+        diag = np.empty(nodes)
+        upper = np.empty(nodes)
+        rhs = np.empty(nodes)
+        c_prime = np.empty(nodes)
+        d_prime = np.empty(nodes)
+
+        for step in range(1, len(times)):
+            dt = times[step] - times[step - 1]
+            if dt <= 0:
+                surface_temps[step] = temperature[0]
+                inner_temps[step] = temperature[-1]
+                continue
+
+            r = diffusivity * dt / dx ** 2
+
+            lower[:] = -r
+            diag[:] = 1.0 + 2.0 * r
+            upper[:] = -r
+            rhs[:] = temperature
+
+            # Outer face: heated through a ghost node carrying the flux
+            upper[0] = -2.0 * r
+            rhs[0] += 2.0 * r * dx * heat_flux[step] / conductivity
+            # Inner face: adiabatic
+            lower[-1] = -2.0 * r
+
+            # Thomas algorithm forward sweep / back substitution
+            c_prime[0] = upper[0] / diag[0]
+            d_prime[0] = rhs[0] / diag[0]
+            for i in range(1, nodes):
+                denom = diag[i] - lower[i] * c_prime[i - 1]
+                c_prime[i] = upper[i] / denom
+                d_prime[i] = (rhs[i] - lower[i] * d_prime[i - 1]) / denom
+            temperature[-1] = d_prime[-1]
+            for i in range(nodes - 2, -1, -1):
+                temperature[i] = d_prime[i] - c_prime[i] * temperature[i + 1]
+
+            surface_temps[step] = temperature[0]
+            inner_temps[step] = temperature[-1]
+
+        return {
+            "time": times,
+            "surface_temperature": surface_temps,
+            "inner_temperature": inner_temps,
+            "peak_surface_temperature": float(np.max(surface_temps)),
+            "peak_inner_temperature": float(np.max(inner_temps)),
+            "final_profile": temperature,
+            "material": material,
+            "thickness": thickness,
+            "nodes": nodes
+        }
\ No newline at end of file
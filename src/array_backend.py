@@ -0,0 +1,33 @@
+import numpy as np
+
+try:
+    import cupy
+    CUPY_AVAILABLE = True
+except ImportError:
+    cupy = None
+    CUPY_AVAILABLE = False
+
+
+def get_array_module(backend=None):
+    """Resolve the array namespace the batch kernels should run on.
+
+    backend overrides the performance.array_backend config entry. "cupy"
+    returns CuPy when it is installed so the same kernel source runs on
+    the GPU; anything else (or a missing CuPy) falls back to NumPy.
+    """
+    if backend is None:
+        try:
+            from config import config as app_config
+            backend = app_config.get("performance.array_backend", "numpy")
+        except Exception:
+            backend = "numpy"
+    if backend == "cupy" and CUPY_AVAILABLE:
+        return cupy
+    return np
+
+
+def to_numpy(array):
+    """Copy a device array back to host memory; a no-op for NumPy input."""
+    if cupy is not None and isinstance(array, cupy.ndarray):
+        return cupy.asnumpy(array)
+    return np.asarray(array)
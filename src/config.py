@@ -52,7 +52,9 @@ class Config:
             "performance": {
                 "multiprocessing_enabled": True,
                 "cache_enabled": True,
-                "max_cache_size": 100
+                "max_cache_size": 100,
+                "jit_enabled": True,
+                "array_backend": "numpy"
             }
         }
         self.config = self.load_config()
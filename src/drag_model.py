@@ -0,0 +1,61 @@
+import numpy as np
+
+from Engine import get_atmosphere_table
+
+
+class DragModel:
+    """Unified drag evaluation shared by both engines.
+
+    Replaces the scalar exp/sqrt/branch drag code that was duplicated in
+    Engine.calculate_drag and AdvancedRocketEngine._calculate_drag. The
+    Cd-vs-Mach curve is precomputed once on a dense grid and density and
+    speed of sound come from the shared AtmosphereTable, so each
+    evaluation is two table interpolations. drag_batch serves whole
+    arrays of states per call for the vectorized core, the Monte Carlo
+    engine and the optimizer.
+    """
+
+    def __init__(self, atmosphere=None, max_mach=5.0, resolution=0.01):
+        self.atmosphere = atmosphere if atmosphere is not None else get_atmosphere_table()
+        self.resolution = float(resolution)
+        self.machs = np.arange(0.0, max_mach + resolution, resolution)
+        self.cds = np.where(
+            self.machs < 0.8, 0.3,
+            np.where(self.machs < 1.1,
+                     0.3 + (self.machs - 0.8) * 1.0,
+                     0.6 - 0.1 * np.minimum(self.machs - 1.1, 0.4)))
+
+    def cd(self, mach):
+        pos = mach / self.resolution
+        idx = int(pos)
+        last = len(self.cds) - 1
+        if idx >= last:
+            return float(self.cds[last])
+        frac = pos - idx
+        return float(self.cds[idx] * (1.0 - frac) + self.cds[idx + 1] * frac)
+
+    def drag(self, velocity, altitude, reference_area=1.0):
+        density = self.atmosphere.density(altitude)
+        speed_of_sound = max(self.atmosphere.speed_of_sound(altitude), 0.1)
+        cd = self.cd(abs(velocity) / speed_of_sound)
+        drag = 0.5 * density * velocity ** 2 * reference_area * cd
+        return drag if velocity > 0 else -drag
+
+    def drag_batch(self, velocities, altitudes, reference_area=1.0):
+        velocities = np.asarray(velocities, dtype=np.float64)
+        altitudes = np.asarray(altitudes, dtype=np.float64)
+        density = self.atmosphere.density_batch(altitudes)
+        speed_of_sound = np.maximum(self.atmosphere.speed_of_sound_batch(altitudes), 0.1)
+        cd = np.interp(np.abs(velocities) / speed_of_sound, self.machs, self.cds)
+        drag = 0.5 * density * velocities ** 2 * reference_area * cd
+        return np.where(velocities > 0, drag, -drag)
+
+
+_drag_model = None
+
+
+def get_drag_model():
+    global _drag_model
+    if _drag_model is None:
+        _drag_model = DragModel()
+    return _drag_model
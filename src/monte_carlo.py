@@ -0,0 +1,193 @@
+import numpy as np
+
+from Engine import (BATCH_SUMMARY_CHANNELS, _summarize_result,
+                    rocket_simulation_vectorized)
+
+SIMULATION_PARAMETERS = ("cocp", "ct", "altitude", "intmass", "propmass",
+                         "mfr", "dt", "reference_area")
+
+
+def sample_distribution(rng, spec, size):
+    """Draw samples from a distribution spec dict.
+
+    Supported specs:
+        {"dist": "normal", "mean": m, "std": s}
+        {"dist": "uniform", "low": a, "high": b}
+        {"dist": "triangular", "left": a, "mode": m, "right": b}
+    """
+    kind = spec.get("dist", "normal")
+    if kind == "normal":
+        return rng.normal(spec["mean"], spec["std"], size)
+    if kind == "uniform":
+        return rng.uniform(spec["low"], spec["high"], size)
+    if kind == "triangular":
+        return rng.triangular(spec["left"], spec["mode"], spec["right"], size)
+    raise ValueError(f"Unknown distribution: {kind}")
+
+
+def _mc_worker(args):
+    index, case, shm_name, summary_shape, traj_shape = args
+    from multiprocessing import shared_memory
+    result = rocket_simulation_vectorized(**case)
+    summary = _summarize_result(result)
+
+    shm = shared_memory.SharedMemory(name=shm_name)
+    summary_bytes = 8 * summary_shape[0] * summary_shape[1]
+    summaries = np.ndarray(summary_shape, dtype=np.float64, buffer=shm.buf[:summary_bytes])
+    trajectories = None
+    if traj_shape is not None:
+        trajectories = np.ndarray(traj_shape, dtype=np.float64,
+                                  buffer=shm.buf[summary_bytes:])
+    try:
+        summaries[index, :] = summary
+
+        if trajectories is not None:
+            time = np.asarray(result.get("time", []), dtype=np.float64)
+            points = traj_shape[2]
+            if len(time) >= 2:
+                grid = np.linspace(time[0], time[-1], points)
+                trajectories[index, 0, :] = grid
+                trajectories[index, 1, :] = np.interp(grid, time, np.asarray(result["altitude"], dtype=np.float64))
+                trajectories[index, 2, :] = np.interp(grid, time, np.asarray(result["velocity"], dtype=np.float64))
+            else:
+                trajectories[index, :, :] = np.nan
+    finally:
+        # The views (and the shm.buf slices backing them) export the
+        # block; release them before close() or it raises BufferError.
+        del summaries, trajectories
+        shm.close()
+    return index
+
+
+class MonteCarloStudy:
+    """Monte Carlo dispersion analysis over rocket_simulation parameters.
+
+    dispersions maps SimulationConfig-style parameter names (intmass,
+    propmass, mfr, ct, ...) to distribution spec dicts; every other
+    parameter is held at its base_config value. run() fans the sampled
+    cases out across worker processes which write per-case summary
+    statistics — and, when trajectory_points > 0, trajectories decimated
+    onto a uniform per-case time grid — straight into one shared-memory
+    block, so the multi-gigabyte per-step dicts never cross a pipe.
+    """
+
+    def __init__(self, base_config, dispersions, samples=1000, seed=None,
+                 trajectory_points=0):
+        for name in dispersions:
+            if name not in SIMULATION_PARAMETERS:
+                raise ValueError(f"Unknown simulation parameter: {name}")
+        self.base_config = dict(base_config)
+        self.dispersions = dict(dispersions)
+        self.samples = int(samples)
+        self.seed = seed
+        self.trajectory_points = int(trajectory_points)
+        self.summaries = None
+        self.trajectories = None
+        self.cases = None
+
+    def draw_cases(self):
+        rng = np.random.default_rng(self.seed)
+        draws = {name: sample_distribution(rng, spec, self.samples)
+                 for name, spec in self.dispersions.items()}
+        cases = []
+        for i in range(self.samples):
+            case = dict(self.base_config)
+            for name, values in draws.items():
+                case[name] = float(values[i])
+            cases.append(case)
+        return cases
+
+    def run(self, progress_callback=None, processes=None):
+        self.cases = self.draw_cases()
+        n = self.samples
+        summary_shape = (max(n, 1), len(BATCH_SUMMARY_CHANNELS))
+        traj_shape = ((max(n, 1), 3, self.trajectory_points)
+                      if self.trajectory_points > 0 else None)
+
+        summary_bytes = 8 * summary_shape[0] * summary_shape[1]
+        traj_bytes = 8 * n * 3 * self.trajectory_points if traj_shape else 0
+
+        try:
+            from config import config as app_config
+            use_pool = bool(app_config.get("performance.multiprocessing_enabled", True))
+        except Exception:
+            use_pool = True
+
+        if use_pool and n > 1:
+            import multiprocessing
+            from multiprocessing import shared_memory
+
+            shm = shared_memory.SharedMemory(create=True, size=summary_bytes + max(traj_bytes, 8))
+            try:
+                tasks = [(i, case, shm.name, summary_shape, traj_shape)
+                         for i, case in enumerate(self.cases)]
+                with multiprocessing.Pool(processes) as pool:
+                    for done, _ in enumerate(pool.imap_unordered(_mc_worker, tasks), 1):
+                        if progress_callback:
+                            progress_callback(done, n)
+                self.summaries = np.ndarray(summary_shape, dtype=np.float64,
+                                            buffer=shm.buf[:summary_bytes]).copy()
+                if traj_shape:
+                    self.trajectories = np.ndarray(traj_shape, dtype=np.float64,
+                                                   buffer=shm.buf[summary_bytes:]).copy()
+            finally:
+                shm.close()
+                shm.unlink()
+        else:
+            self.summaries = np.empty(summary_shape)
+            if traj_shape:
+                self.trajectories = np.full(traj_shape, np.nan)
+            for i, case in enumerate(self.cases):
+                result = rocket_simulation_vectorized(**case)
+                self.summaries[i, :] = _summarize_result(result)
+                if traj_shape:
+                    time = np.asarray(result["time"], dtype=np.float64)
+                    if len(time) >= 2:
+                        grid = np.linspace(time[0], time[-1], self.trajectory_points)
+                        self.trajectories[i, 0, :] = grid
+                        self.trajectories[i, 1, :] = np.interp(grid, time, np.asarray(result["altitude"], dtype=np.float64))
+                        self.trajectories[i, 2, :] = np.interp(grid, time, np.asarray(result["velocity"], dtype=np.float64))
+                if progress_callback:
+                    progress_callback(i + 1, n)
+
+        return self.channel_arrays()
+
+    def channel_arrays(self):
+        return {name: self.summaries[:self.samples, j]
+                for j, name in enumerate(BATCH_SUMMARY_CHANNELS)}
+
+    def summary_statistics(self, percentiles=(5, 50, 95)):
+        stats = {}
+        for name, values in self.channel_arrays().items():
+            finite = values[np.isfinite(values)]
+            if len(finite) == 0:
+                continue
+            entry = {"mean": float(np.mean(finite)), "std": float(np.std(finite))}
+            for p in percentiles:
+                entry[f"p{p}"] = float(np.percentile(finite, p))
+            stats[name] = entry
+        return stats
+
+    def percentile_fan(self, channel="altitude", percentiles=(5, 25, 50, 75, 95), points=200):
+        """Percentile envelopes of the stored trajectories over absolute time.
+
+        Returns (time_grid, bands) where bands maps each percentile to a
+        curve of length points. Cases that end early hold their final
+        value, which keeps the fan defined out to the longest flight.
+        """
+        if self.trajectories is None:
+            raise ValueError("run() with trajectory_points > 0 before requesting a fan")
+        row = {"altitude": 1, "velocity": 2}[channel]
+
+        times = self.trajectories[:, 0, :]
+        valid = np.isfinite(times[:, -1])
+        if not np.any(valid):
+            raise ValueError("No valid trajectories recorded")
+        grid = np.linspace(0.0, float(np.max(times[valid, -1])), points)
+
+        resampled = np.full((self.samples, points), np.nan)
+        for i in np.flatnonzero(valid):
+            resampled[i] = np.interp(grid, times[i], self.trajectories[i, row, :])
+
+        bands = {p: np.nanpercentile(resampled, p, axis=0) for p in percentiles}
+        return grid, bands
@@ -0,0 +1,132 @@
+import logging
+from datetime import datetime
+from typing import Dict, Optional, Tuple
+
+import numpy as np
+
+from Engine import batch_simulate, BATCH_SUMMARY_CHANNELS
+from project_manager import SimulationConfig
+
+
+class TrajectoryOptimizer:
+    """Differential-evolution search over rocket design parameters.
+
+    Wraps the engine as an objective: candidate designs are scored by how
+    close their batch_simulate summary channels (max_altitude, delta_v, ...)
+    land on the requested targets. Whole populations are evaluated per
+    generation through batch_simulate, so the sweep process pool does the
+    heavy lifting and optimization wall time scales with generations, not
+    population size.
+    """
+
+    def __init__(self, base_config: Dict, parameter_bounds: Dict[str, Tuple[float, float]],
+                 targets: Dict[str, float], population_size: int = 24,
+                 mutation: float = 0.7, crossover: float = 0.9, seed: Optional[int] = None):
+        for channel in targets:
+            if channel not in BATCH_SUMMARY_CHANNELS:
+                raise ValueError(f"Unknown target channel: {channel}")
+        if not parameter_bounds:
+            raise ValueError("At least one parameter bound is required")
+
+        self.base_config = dict(base_config)
+        self.parameter_names = list(parameter_bounds)
+        self.lower = np.array([parameter_bounds[name][0] for name in self.parameter_names])
+        self.upper = np.array([parameter_bounds[name][1] for name in self.parameter_names])
+        self.targets = dict(targets)
+        self.population_size = max(population_size, 4)
+        self.mutation = mutation
+        self.crossover = crossover
+        self.rng = np.random.default_rng(seed)
+
+        self.best_parameters: Optional[Dict[str, float]] = None
+        self.best_score = float("inf")
+        self.history = []
+
+    def _build_cases(self, population: np.ndarray):
+        cases = []
+        for row in population:
+            case = dict(self.base_config)
+            for name, value in zip(self.parameter_names, row):
+                case[name] = float(value)
+            cases.append(case)
+        return cases
+
+    def _score_population(self, population: np.ndarray) -> np.ndarray:
+        results = batch_simulate(self._build_cases(population))
+        scores = np.zeros(len(population))
+        for channel, target in self.targets.items():
+            achieved = np.nan_to_num(results[channel], nan=0.0)
+            scale = max(abs(target), 1.0)
+            scores += ((achieved - target) / scale) ** 2
+        return scores
+
+    def optimize(self, generations: int = 40, progress_callback=None) -> Dict:
+        """Run DE/rand/1/bin for the given number of generations."""
+        dim = len(self.parameter_names)
+        population = self.lower + self.rng.random((self.population_size, dim)) * (self.upper - self.lower)
+        scores = self._score_population(population)
+
+        logging.info(f"Starting optimization: {self.population_size} candidates, {generations} generations")
+
+        for generation in range(generations):
+            # Donor vectors from three distinct partners per candidate
+            idx = np.arange(self.population_size)
+            a, b, c = (self.rng.permuted(idx) for _ in range(3))
+            donors = population[a] + self.mutation * (population[b] - population[c])
+            donors = np.clip(donors, self.lower, self.upper)
+
+            cross = self.rng.random((self.population_size, dim)) < self.crossover
+            cross[idx, self.rng.integers(0, dim, self.population_size)] = True
+            trials = np.where(cross, donors, population)
+
+            trial_scores = self._score_population(trials)
+            improved = trial_scores < scores
+            population[improved] = trials[improved]
+            scores[improved] = trial_scores[improved]
+
+            best_idx = int(np.argmin(scores))
+            if scores[best_idx] < self.best_score:
+                self.best_score = float(scores[best_idx])
+                self.best_parameters = dict(zip(self.parameter_names, population[best_idx].tolist()))
+
+            self.history.append(self.best_score)
+            if progress_callback:
+                progress_callback(generation + 1, generations, self.best_score)
+
+        logging.info(f"Optimization complete: best score {self.best_score:.6f}")
+
+        return {
+            "parameters": self.best_parameters,
+            "score": self.best_score,
+            "history": self.history,
+            "targets": self.targets
+        }
+
+    def to_simulation_config(self, name: str, description: str = "", tags=None) -> SimulationConfig:
+        """Build a SimulationConfig from the base config plus the best design."""
+        if self.best_parameters is None:
+            raise ValueError("No optimized design available; run optimize() first")
+
+        merged = dict(self.base_config)
+        merged.update(self.best_parameters)
+        now = datetime.now().isoformat()
+
+        return SimulationConfig(
+            name=name,
+            description=description or f"Optimized for {self.targets}",
+            created_date=now,
+            modified_date=now,
+            fuel_type=merged.get("fuel_type", "RP1"),
+            chamber_pressure=merged.get("cocp", 7000000),
+            combustion_temp=merged.get("ct", 3500),
+            initial_altitude=merged.get("altitude", 0),
+            total_mass=merged.get("intmass", 10000),
+            propellant_mass=merged.get("propmass", 8000),
+            mass_flow_rate=merged.get("mfr", 250),
+            time_step=merged.get("dt", 0.1),
+            reference_area=merged.get("reference_area", 1.0),
+            tags=tags if tags is not None else ["optimized"]
+        )
+
+    def save_to_project(self, project_manager, project_id: str, name: str) -> bool:
+        return project_manager.save_simulation_config(project_id, self.to_simulation_config(name))
@@ -0,0 +1,53 @@
+import numpy as np
+
+
+def decimate_envelope(x, y, max_points=2000):
+    """Reduce a series to a min/max envelope for plotting.
+
+    Splits the series into max_points/2 buckets (one per screen column at
+    typical chart widths) and keeps the minimum and maximum sample of each
+    bucket in positional order, so peaks and troughs survive while the
+    artist carries O(pixels) vertices instead of O(steps). Returns the
+    input unchanged when it is already small enough.
+    """
+    x = np.asarray(x, dtype=np.float64)
+    y = np.asarray(y, dtype=np.float64)
+    n = len(x)
+    if n <= max_points or max_points < 4:
+        return x, y
+
+    n_buckets = max_points // 2
+    bucket_size = n // n_buckets
+    usable = n_buckets * bucket_size
+
+    xb = x[:usable].reshape(n_buckets, bucket_size)
+    yb = y[:usable].reshape(n_buckets, bucket_size)
+
+    lo = np.argmin(yb, axis=1)
+    hi = np.argmax(yb, axis=1)
+    rows = np.arange(n_buckets)
+
+    # Keep the two extremes of each bucket in the order they occur.
+    first = np.minimum(lo, hi)
+    second = np.maximum(lo, hi)
+    x_out = np.empty(2 * n_buckets + (n - usable))
+    y_out = np.empty_like(x_out)
+    x_out[0:2 * n_buckets:2] = xb[rows, first]
+    x_out[1:2 * n_buckets:2] = xb[rows, second]
+    y_out[0:2 * n_buckets:2] = yb[rows, first]
+    y_out[1:2 * n_buckets:2] = yb[rows, second]
+
+    # Tail samples that did not fill a bucket are kept as-is.
+    x_out[2 * n_buckets:] = x[usable:]
+    y_out[2 * n_buckets:] = y[usable:]
+    return x_out, y_out
+
+
+def decimate_uniform(series, max_points=1000):
+    """Uniformly subsample a series to at most max_points, keeping the ends."""
+    series = np.asarray(series, dtype=np.float64)
+    n = len(series)
+    if n <= max_points:
+        return series
+    idx = np.linspace(0, n - 1, max_points).astype(np.intp)
+    return series[idx]
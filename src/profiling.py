@@ -0,0 +1,82 @@
+import threading
+import time
+from contextlib import contextmanager
+
+import numpy as np
+
+
+class Profiler:
+    """Cumulative wall-time counters for hot code sections.
+
+    Sections register once and get a fixed slot in preallocated arrays;
+    recording a sample is a monotonic-clock delta plus three array
+    stores, cheap enough to leave enabled in production. snapshot()
+    returns the accumulated totals for the performance dashboard.
+    """
+
+    def __init__(self, capacity=64):
+        self._lock = threading.Lock()
+        self._slots = {}
+        self.totals = np.zeros(capacity)
+        self.counts = np.zeros(capacity, dtype=np.int64)
+        self.last = np.zeros(capacity)
+
+    def section(self, name):
+        with self._lock:
+            if name not in self._slots:
+                if len(self._slots) >= len(self.totals):
+                    self.totals = np.concatenate([self.totals, np.zeros(len(self.totals))])
+                    self.counts = np.concatenate([self.counts, np.zeros(len(self.counts), dtype=np.int64)])
+                    self.last = np.concatenate([self.last, np.zeros(len(self.last))])
+                self._slots[name] = len(self._slots)
+            return self._slots[name]
+
+    def record(self, slot, started):
+        elapsed = time.perf_counter() - started
+        self.totals[slot] += elapsed
+        self.counts[slot] += 1
+        self.last[slot] = elapsed
+        return elapsed
+
+    @contextmanager
+    def timed(self, name):
+        slot = self.section(name)
+        started = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.record(slot, started)
+
+    def snapshot(self):
+        with self._lock:
+            names = dict(self._slots)
+        rows = []
+        for name, slot in names.items():
+            count = int(self.counts[slot])
+            if count == 0:
+                continue
+            total = float(self.totals[slot])
+            rows.append({
+                "section": name,
+                "calls": count,
+                "total_s": total,
+                "mean_ms": total / count * 1000.0,
+                "last_ms": float(self.last[slot]) * 1000.0
+            })
+        rows.sort(key=lambda row: row["total_s"], reverse=True)
+        return rows
+
+    def reset(self):
+        self.totals[:] = 0.0
+        self.counts[:] = 0
+        self.last[:] = 0.0
+
+
+_profiler = None
+
+
+def get_profiler():
+    global _profiler
+    if _profiler is None:
+        _profiler = Profiler()
+    return _profiler
@@ -1,222 +1,362 @@
-import json
-import os
-import shutil
-from datetime import datetime
-from typing import Dict, List, Optional, Any
-from dataclasses import dataclass, asdict
-import zipfile
-
-@dataclass
-class SimulationConfig:
-    name: str
-    description: str
-    created_date: str
-    modified_date: str
-    fuel_type: str
-    chamber_pressure: float
-    combustion_temp: float
-    initial_altitude: float
-    total_mass: float
-    propellant_mass: float
-    mass_flow_rate: float
-    time_step: float
-    reference_area: float
-    tags: List[str]
-    version: str = "1.0"
-
-class ProjectManager:
-
-    def __init__(self, projects_dir: str = "projects"):
-        self.projects_dir = projects_dir
-        self.current_project: Optional[str] = None
-        self.projects_file = os.path.join(projects_dir, "projects.json")
-        self._ensure_directory()
-        self.projects = self._load_projects()
-    
-    def _ensure_directory(self):
-        if not os.path.exists(self.projects_dir):
-            os.makedirs(self.projects_dir)
-    
-    def _load_projects(self) -> Dict[str, Any]:
-        if os.path.exists(self.projects_file):
-            try:
-                with open(self.projects_file, 'r') as f:
-                    return json.load(f)
-            except (json.JSONDecodeError, FileNotFoundError):
-                return {}
-        return {}
-    
-    def _save_projects(self):
-        with open(self.projects_file, 'w') as f:
-            json.dump(self.projects, f, indent=4)
-    
-    def create_project(self, name: str, description: str = "", tags: Optional[List[str]] = None) -> str:
-        if tags is None:
-            tags = []
-        
-        project_id = f"{name.lower().replace(' ', '_')}_{datetime.now().strftime('%Y%m%d_%H%M%S')}"
-        project_dir = os.path.join(self.projects_dir, project_id)
-        
-        if os.path.exists(project_dir):
-            raise ValueError(f"Project directory already exists: {project_id}")
-        
-        os.makedirs(project_dir)
-        
-        default_config = SimulationConfig(
-            name=name,
-            description=description,
-            created_date=datetime.now().isoformat(),
-            modified_date=datetime.now().isoformat(),
-            fuel_type="RP1",
-            chamber_pressure=7000000,
-            combustion_temp=3500,
-            initial_altitude=0,
-            total_mass=10000,
-            propellant_mass=8000,
-            mass_flow_rate=250,
-            time_step=0.1,
-            reference_area=1.0,
-            tags=tags
-        )
-        
-        self.projects[project_id] = {
-            "name": name,
-            "description": description,
-            "created_date": default_config.created_date,
-            "modified_date": default_config.modified_date,
-            "tags": tags,
-            "simulations": [default_config.name]
-        }
-        
-        self.save_simulation_config(project_id, default_config)
-        self._save_projects()
-        
-        return project_id
-    
-    def save_simulation_config(self, project_id: str, config: SimulationConfig) -> bool:
-        if project_id not in self.projects:
-            raise ValueError(f"Project not found: {project_id}")
-        
-        project_dir = os.path.join(self.projects_dir, project_id)
-        config_file = os.path.join(project_dir, f"{config.name.lower().replace(' ', '_')}.json")
-        
-        config.modified_date = datetime.now().isoformat()
-        
-        with open(config_file, 'w') as f:
-            json.dump(asdict(config), f, indent=4)
-        
-        if config.name not in self.projects[project_id]["simulations"]:
-            self.projects[project_id]["simulations"].append(config.name)
-        self.projects[project_id]["modified_date"] = config.modified_date
-        self._save_projects()
-        
-        return True
-    
-    def load_simulation_config(self, project_id: str, config_name: str) -> Optional[SimulationConfig]:
-        if project_id not in self.projects:
-            return None
-        
-        project_dir = os.path.join(self.projects_dir, project_id)
-        config_file = os.path.join(project_dir, f"{config_name.lower().replace(' ', '_')}.json")
-        
-        if not os.path.exists(config_file):
-            return None
-        
-        try:
-            with open(config_file, 'r') as f:
-                data = json.load(f)
-                return SimulationConfig(**data)
-        except (json.JSONDecodeError, KeyError):
-            return None
-    
-    def list_projects(self) -> List[Dict[str, Any]]:
-        return [
-            {
-                "id": project_id,
-                "name": data["name"],
-                "description": data["description"],
-                "created_date": data["created_date"],
-                "modified_date": data["modified_date"],
-                "tags": data["tags"],
-                "simulation_count": len(data["simulations"])
-            }
-            for project_id, data in self.projects.items()
-        ]
-    
-    def list_simulations(self, project_id: str) -> List[str]:
-        if project_id not in self.projects:
-            return []
-        return self.projects[project_id]["simulations"]
-    
-    def delete_project(self, project_id: str) -> bool:
-        if project_id not in self.projects:
-            return False
-        
-        project_dir = os.path.join(self.projects_dir, project_id)
-        if os.path.exists(project_dir):
-            shutil.rmtree(project_dir)
-        
-        del self.projects[project_id]
-        self._save_projects()
-        return True
-    
-    def export_project(self, project_id: str, export_path: str) -> bool:
-        if project_id not in self.projects:
-            return False
-        
-        project_dir = os.path.join(self.projects_dir, project_id)
-        if not os.path.exists(project_dir):
-            return False
-        
-        try:
-            with zipfile.ZipFile(export_path, 'w', zipfile.ZIP_DEFLATED) as zipf:
-                for root, dirs, files in os.walk(project_dir):
-                    for file in files:
-                        file_path = os.path.join(root, file)
-                        arcname = os.path.relpath(file_path, project_dir)
-                        zipf.write(file_path, arcname)
-            
-            zipf.writestr("project_info.json", json.dumps(self.projects[project_id], indent=4))
-            return True
-        except Exception as e:
-            print(f"Export error: {e}")
-            return False
-    
-    def import_project(self, import_path: str) -> Optional[str]:
-        try:
-            with zipfile.ZipFile(import_path, 'r') as zipf:
-                project_info = json.loads(zipf.read("project_info.json"))
-                
-                project_id = f"{project_info['name'].lower().replace(' ', '_')}_{datetime.now().strftime('%Y%m%d_%H%M%S')}"
-                project_dir = os.path.join(self.projects_dir, project_id)
-                
-                zipf.extractall(project_dir)
-                
-                project_info["imported_date"] = datetime.now().isoformat()
-                self.projects[project_id] = project_info
-                self._save_projects()
-                
-                return project_id
-        except Exception as e:
-            print(f"Import error: {e}")
-            return None
-    
-    def search_projects(self, query: str) -> List[Dict[str, Any]]:
-        query = query.lower()
-        results = []
-        
-        for project_id, data in self.projects.items():
-            if (query in data["name"].lower() or 
-                query in data["description"].lower() or 
-                any(query in tag.lower() for tag in data["tags"])):
-                results.append({
-                    "id": project_id,
-                    "name": data["name"],
-                    "description": data["description"],
-                    "created_date": data["created_date"],
-                    "modified_date": data["modified_date"],
-                    "tags": data["tags"],
-                    "simulation_count": len(data["simulations"])
-                })
-        
-        return results 
\ No newline at end of file
+import hashlib
+import json
+import os
+import shutil
+import sqlite3
+from datetime import datetime
+from typing import Dict, List, Optional, Any
+from dataclasses import dataclass, asdict
+import zipfile
+
+@dataclass
+class SimulationConfig:
+    name: str
+    description: str
+    created_date: str
+    modified_date: str
+    fuel_type: str
+    chamber_pressure: float
+    combustion_temp: float
+    initial_altitude: float
+    total_mass: float
+    propellant_mass: float
+    mass_flow_rate: float
+    time_step: float
+    reference_area: float
+    tags: List[str]
+    version: str = "1.0"
+
+class ProjectManager:
+    """Project metadata store backed by an SQLite index.
+
+    Replaces the monolithic projects.json (rewritten in full on every
+    change) with incremental upserts into indexed projects, simulations
+    and tags tables, so saves stay fast and search uses the index at
+    thousands of projects. An existing projects.json is migrated once on
+    first open and renamed aside.
+    """
+
+    def __init__(self, projects_dir: str = "projects"):
+        self.projects_dir = projects_dir
+        self.current_project: Optional[str] = None
+        self.projects_file = os.path.join(projects_dir, "projects.json")
+        self.db_file = os.path.join(projects_dir, "projects.db")
+        self._ensure_directory()
+        self.db = sqlite3.connect(self.db_file, check_same_thread=False)
+        self.db.row_factory = sqlite3.Row
+        self._init_db()
+        self._migrate_json()
+
+    def _ensure_directory(self):
+        if not os.path.exists(self.projects_dir):
+            os.makedirs(self.projects_dir)
+
+    def _init_db(self):
+        with self.db:
+            self.db.execute("PRAGMA foreign_keys = ON")
+            self.db.executescript("""
+                CREATE TABLE IF NOT EXISTS projects (
+                    id TEXT PRIMARY KEY,
+                    name TEXT NOT NULL,
+                    description TEXT NOT NULL DEFAULT '',
+                    created_date TEXT,
+                    modified_date TEXT,
+                    extra TEXT NOT NULL DEFAULT '{}'
+                );
+                CREATE TABLE IF NOT EXISTS simulations (
+                    project_id TEXT NOT NULL REFERENCES projects(id) ON DELETE CASCADE,
+                    name TEXT NOT NULL,
+                    position INTEGER NOT NULL,
+                    PRIMARY KEY (project_id, name)
+                );
+                CREATE TABLE IF NOT EXISTS tags (
+                    project_id TEXT NOT NULL REFERENCES projects(id) ON DELETE CASCADE,
+                    tag TEXT NOT NULL,
+                    PRIMARY KEY (project_id, tag)
+                );
+                CREATE INDEX IF NOT EXISTS idx_projects_name ON projects(name);
+                CREATE INDEX IF NOT EXISTS idx_tags_tag ON tags(tag);
+                CREATE INDEX IF NOT EXISTS idx_simulations_project ON simulations(project_id);
+            """)
+
+    def _migrate_json(self):
+        if not os.path.exists(self.projects_file):
+            return
+        try:
+            with open(self.projects_file, 'r') as f:
+                legacy = json.load(f)
+        except (json.JSONDecodeError, OSError):
+            return
+
+        for project_id, data in legacy.items():
+            self._upsert_project(project_id, data)
+
+        os.replace(self.projects_file, self.projects_file + ".migrated")
+
+    def _upsert_project(self, project_id: str, data: Dict[str, Any]):
+        known = {"name", "description", "created_date", "modified_date", "tags", "simulations"}
+        extra = {key: value for key, value in data.items() if key not in known}
+        with self.db:
+            self.db.execute(
+                """INSERT INTO projects (id, name, description, created_date, modified_date, extra)
+                   VALUES (?, ?, ?, ?, ?, ?)
+                   ON CONFLICT(id) DO UPDATE SET
+                       name=excluded.name, description=excluded.description,
+                       created_date=excluded.created_date,
+                       modified_date=excluded.modified_date, extra=excluded.extra""",
+                (project_id, data.get("name", project_id), data.get("description", ""),
+                 data.get("created_date"), data.get("modified_date"), json.dumps(extra)))
+            self.db.execute("DELETE FROM tags WHERE project_id = ?", (project_id,))
+            self.db.executemany("INSERT INTO tags (project_id, tag) VALUES (?, ?)",
+                                [(project_id, tag) for tag in data.get("tags", [])])
+            self.db.execute("DELETE FROM simulations WHERE project_id = ?", (project_id,))
+            self.db.executemany(
+                "INSERT INTO simulations (project_id, name, position) VALUES (?, ?, ?)",
+                [(project_id, name, i) for i, name in enumerate(data.get("simulations", []))])
+
+    def _get_project(self, project_id: str) -> Optional[Dict[str, Any]]:
+        row = self.db.execute("SELECT * FROM projects WHERE id = ?", (project_id,)).fetchone()
+        if row is None:
+            return None
+        data = {
+            "name": row["name"],
+            "description": row["description"],
+            "created_date": row["created_date"],
+            "modified_date": row["modified_date"],
+            "tags": [r["tag"] for r in self.db.execute(
+                "SELECT tag FROM tags WHERE project_id = ?", (project_id,))],
+            "simulations": self.list_simulations(project_id)
+        }
+        data.update(json.loads(row["extra"]))
+        return data
+
+    def _project_exists(self, project_id: str) -> bool:
+        return self.db.execute("SELECT 1 FROM projects WHERE id = ?",
+                               (project_id,)).fetchone() is not None
+
+    def _row_to_summary(self, row) -> Dict[str, Any]:
+        return {
+            "id": row["id"],
+            "name": row["name"],
+            "description": row["description"],
+            "created_date": row["created_date"],
+            "modified_date": row["modified_date"],
+            "tags": [r["tag"] for r in self.db.execute(
+                "SELECT tag FROM tags WHERE project_id = ?", (row["id"],))],
+            "simulation_count": self.db.execute(
+                "SELECT COUNT(*) FROM simulations WHERE project_id = ?",
+                (row["id"],)).fetchone()[0]
+        }
+
+    def create_project(self, name: str, description: str = "", tags: Optional[List[str]] = None) -> str:
+        if tags is None:
+            tags = []
+
+        project_id = f"{name.lower().replace(' ', '_')}_{datetime.now().strftime('%Y%m%d_%H%M%S')}"
+        project_dir = os.path.join(self.projects_dir, project_id)
+
+        if os.path.exists(project_dir):
+            raise ValueError(f"Project directory already exists: {project_id}")
+
+        os.makedirs(project_dir)
+
+        default_config = SimulationConfig(
+            name=name,
+            description=description,
+            created_date=datetime.now().isoformat(),
+            modified_date=datetime.now().isoformat(),
+            fuel_type="RP1",
+            chamber_pressure=7000000,
+            combustion_temp=3500,
+            initial_altitude=0,
+            total_mass=10000,
+            propellant_mass=8000,
+            mass_flow_rate=250,
+            time_step=0.1,
+            reference_area=1.0,
+            tags=tags
+        )
+
+        with self.db:
+            self.db.execute(
+                "INSERT INTO projects (id, name, description, created_date, modified_date) VALUES (?, ?, ?, ?, ?)",
+                (project_id, name, description, default_config.created_date, default_config.modified_date))
+            self.db.executemany("INSERT INTO tags (project_id, tag) VALUES (?, ?)",
+                                [(project_id, tag) for tag in tags])
+
+        self.save_simulation_config(project_id, default_config)
+
+        return project_id
+
+    def save_simulation_config(self, project_id: str, config: SimulationConfig) -> bool:
+        if not self._project_exists(project_id):
+            raise ValueError(f"Project not found: {project_id}")
+
+        project_dir = os.path.join(self.projects_dir, project_id)
+        config_file = os.path.join(project_dir, f"{config.name.lower().replace(' ', '_')}.json")
+
+        config.modified_date = datetime.now().isoformat()
+
+        with open(config_file, 'w') as f:
+            json.dump(asdict(config), f, indent=4)
+
+        with self.db:
+            self.db.execute(
+                """INSERT INTO simulations (project_id, name, position)
+                   VALUES (?, ?, (SELECT COALESCE(MAX(position) + 1, 0)
+                                  FROM simulations WHERE project_id = ?))
+                   ON CONFLICT(project_id, name) DO NOTHING""",
+                (project_id, config.name, project_id))
+            self.db.execute("UPDATE projects SET modified_date = ? WHERE id = ?",
+                            (config.modified_date, project_id))
+
+        return True
+
+    def load_simulation_config(self, project_id: str, config_name: str) -> Optional[SimulationConfig]:
+        if not self._project_exists(project_id):
+            return None
+
+        project_dir = os.path.join(self.projects_dir, project_id)
+        config_file = os.path.join(project_dir, f"{config_name.lower().replace(' ', '_')}.json")
+
+        if not os.path.exists(config_file):
+            return None
+
+        try:
+            with open(config_file, 'r') as f:
+                data = json.load(f)
+                return SimulationConfig(**data)
+        except (json.JSONDecodeError, KeyError):
+            return None
+
+    def list_projects(self) -> List[Dict[str, Any]]:
+        rows = self.db.execute("SELECT * FROM projects ORDER BY created_date").fetchall()
+        return [self._row_to_summary(row) for row in rows]
+
+    def list_simulations(self, project_id: str) -> List[str]:
+        rows = self.db.execute(
+            "SELECT name FROM simulations WHERE project_id = ? ORDER BY position",
+            (project_id,)).fetchall()
+        return [row["name"] for row in rows]
+
+    def delete_project(self, project_id: str) -> bool:
+        if not self._project_exists(project_id):
+            return False
+
+        project_dir = os.path.join(self.projects_dir, project_id)
+        if os.path.exists(project_dir):
+            shutil.rmtree(project_dir)
+
+        with self.db:
+            self.db.execute("PRAGMA foreign_keys = ON")
+            self.db.execute("DELETE FROM projects WHERE id = ?", (project_id,))
+        return True
+
+    def _set_extra(self, project_id: str, key: str, value: Any):
+        row = self.db.execute("SELECT extra FROM projects WHERE id = ?", (project_id,)).fetchone()
+        if row is None:
+            return
+        extra = json.loads(row["extra"])
+        extra[key] = value
+        with self.db:
+            self.db.execute("UPDATE projects SET extra = ? WHERE id = ?",
+                            (json.dumps(extra), project_id))
+
+    @staticmethod
+    def _hash_file(file_path: str) -> str:
+        digest = hashlib.sha256()
+        with open(file_path, 'rb') as f:
+            for chunk in iter(lambda: f.read(1024 * 1024), b''):
+                digest.update(chunk)
+        return digest.hexdigest()
+
+    def _tree_hashes(self, project_dir: str) -> Dict[str, str]:
+        hashes = {}
+        for root, dirs, files in os.walk(project_dir):
+            for file in files:
+                file_path = os.path.join(root, file)
+                arcname = os.path.relpath(file_path, project_dir)
+                hashes[arcname] = self._hash_file(file_path)
+        return hashes
+
+    def export_project(self, project_id: str, export_path: str, delta_only: bool = False) -> bool:
+        """Export a project tree as a zip archive.
+
+        Per-file SHA-256 hashes are recorded in the project metadata so
+        repeated exports can skip work: an unchanged tree exported to the
+        same path is not rewritten, and delta_only=True archives only the
+        files that changed since the previous export (plus a manifest of
+        the full tree for reassembly). Files are streamed into the
+        archive in chunks rather than read whole.
+        """
+        project_info = self._get_project(project_id)
+        if project_info is None:
+            return False
+
+        project_dir = os.path.join(self.projects_dir, project_id)
+        if not os.path.exists(project_dir):
+            return False
+
+        try:
+            hashes = self._tree_hashes(project_dir)
+            previous = project_info.get("export_hashes", {})
+
+            if (not delta_only and hashes == previous
+                    and project_info.get("last_export_path") == export_path
+                    and os.path.exists(export_path)):
+                return True
+
+            if delta_only:
+                to_archive = [name for name, digest in hashes.items()
+                              if previous.get(name) != digest]
+            else:
+                to_archive = list(hashes)
+
+            project_info.pop("export_hashes", None)
+            project_info.pop("last_export_path", None)
+
+            with zipfile.ZipFile(export_path, 'w', zipfile.ZIP_DEFLATED) as zipf:
+                for arcname in to_archive:
+                    zipf.write(os.path.join(project_dir, arcname), arcname)
+                zipf.writestr("project_info.json", json.dumps(project_info, indent=4))
+                if delta_only:
+                    zipf.writestr("delta_manifest.json", json.dumps({
+                        "base_hashes": previous,
+                        "tree_hashes": hashes,
+                        "included": to_archive
+                    }, indent=4))
+
+            self._set_extra(project_id, "export_hashes", hashes)
+            self._set_extra(project_id, "last_export_path", export_path)
+            return True
+        except Exception as e:
+            print(f"Export error: {e}")
+            return False
+
+    def import_project(self, import_path: str) -> Optional[str]:
+        try:
+            with zipfile.ZipFile(import_path, 'r') as zipf:
+                project_info = json.loads(zipf.read("project_info.json"))
+
+                project_id = f"{project_info['name'].lower().replace(' ', '_')}_{datetime.now().strftime('%Y%m%d_%H%M%S')}"
+                project_dir = os.path.join(self.projects_dir, project_id)
+
+                zipf.extractall(project_dir)
+
+                project_info["imported_date"] = datetime.now().isoformat()
+                self._upsert_project(project_id, project_info)
+
+                return project_id
+        except Exception as e:
+            print(f"Import error: {e}")
+            return None
+
+    def search_projects(self, query: str) -> List[Dict[str, Any]]:
+        pattern = f"%{query.lower()}%"
+        rows = self.db.execute(
+            """SELECT DISTINCT p.* FROM projects p
+               LEFT JOIN tags t ON t.project_id = p.id
+               WHERE LOWER(p.name) LIKE ? OR LOWER(p.description) LIKE ? OR LOWER(t.tag) LIKE ?
+               ORDER BY p.created_date""",
+            (pattern, pattern, pattern)).fetchall()
+        return [self._row_to_summary(row) for row in rows]
@@ -2,23 +2,76 @@ import json
 import os
 from datetime import datetime
 from typing import Dict, List, Any, Optional
-import matplotlib.pyplot as plt
-import matplotlib.patches as patches
-from matplotlib.backends.backend_pdf import PdfPages
 import numpy as np
-from reportlab.lib.pagesizes import letter, A4
-from reportlab.platypus import SimpleDocTemplate, Paragraph, Spacer, Table, TableStyle, Image
-from reportlab.lib.styles import getSampleStyleSheet, ParagraphStyle
-from reportlab.lib.units import inch
-from reportlab.lib import colors
-from reportlab.lib.enums import TA_CENTER, TA_LEFT, TA_RIGHT
 import io
 import base64
-from Engine import get_atmospheric_pressure
+from Engine import get_atmosphere_table
+
+# reportlab (and matplotlib, loaded inside the render workers) are
+# deferred so importing this module does not pay their startup cost;
+# _ensure_reportlab() fills the names in when a report is first built.
+_reportlab_loaded = False
+
+
+def _ensure_reportlab():
+    global _reportlab_loaded, letter, A4, SimpleDocTemplate, Paragraph, Spacer
+    global Table, TableStyle, Image, getSampleStyleSheet, ParagraphStyle
+    global inch, colors, TA_CENTER, TA_LEFT, TA_RIGHT
+    if _reportlab_loaded:
+        return
+    from reportlab.lib.pagesizes import letter, A4
+    from reportlab.platypus import SimpleDocTemplate, Paragraph, Spacer, Table, TableStyle, Image
+    from reportlab.lib.styles import getSampleStyleSheet, ParagraphStyle
+    from reportlab.lib.units import inch
+    from reportlab.lib import colors
+    from reportlab.lib.enums import TA_CENTER, TA_LEFT, TA_RIGHT
+    _reportlab_loaded = True
+
+_worker_figures = {}
+
+
+def _get_worker_figure(figsize):
+    """Reuse one Agg figure per geometry within a render worker process."""
+    import matplotlib
+    matplotlib.use("Agg")
+    import matplotlib.pyplot as plt
+
+    fig = _worker_figures.get(figsize)
+    if fig is None:
+        plt.style.use('dark_background')
+        fig = plt.figure(figsize=figsize)
+        _worker_figures[figsize] = fig
+    else:
+        fig.clf()
+    return fig
+
+
+def _render_chart(spec):
+    """Render one chart spec to PNG. Runs off-screen in a worker process."""
+    fig = _get_worker_figure(tuple(spec["figsize"]))
+    rows, cols = spec["layout"]
+
+    for i, panel in enumerate(spec["panels"], start=1):
+        ax = fig.add_subplot(rows, cols, i)
+        ax.plot(panel["x"], panel["y"], panel["style"], linewidth=2, label=panel.get("label"))
+        ax.set_title(panel.get("title", ""))
+        if panel.get("xlabel"):
+            ax.set_xlabel(panel["xlabel"])
+        if panel.get("ylabel"):
+            ax.set_ylabel(panel["ylabel"])
+        ax.grid(True, alpha=0.3)
+        if panel.get("label"):
+            ax.legend()
+
+    fig.tight_layout()
+    fig.savefig(spec["path"], dpi=300, bbox_inches='tight')
+    return spec["path"]
+
 
 class ReportGenerator:
 
     def __init__(self):
+        _ensure_reportlab()
         self.styles = getSampleStyleSheet()
         self._setup_custom_styles()
     
@@ -60,8 +113,14 @@ class ReportGenerator:
                 spaceAfter=12
             ))
     
-    def generate_simulation_report(self, simulation_data: Dict, config: Dict, 
+    def generate_simulation_report(self, simulation_data: Dict, config: Dict,
                                  output_path: str = None) -> str:
+        if simulation_data is None:
+            from result_cache import get_result_cache
+            simulation_data = get_result_cache().get(config)
+            if simulation_data is None:
+                raise ValueError("No simulation data provided and no cached result for this configuration")
+
         if output_path is None:
             timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
             output_path = f"simulation_report_{timestamp}.pdf"
@@ -69,25 +128,27 @@ class ReportGenerator:
         doc = SimpleDocTemplate(output_path, pagesize=A4, rightMargin=72, leftMargin=72, 
                               topMargin=72, bottomMargin=18)
         
+        from profiling import get_profiler
+        profiler = get_profiler()
+
         story = []
-        
-        story.extend(self._create_title_page(simulation_data, config))
-        
-        story.extend(self._create_executive_summary(simulation_data))
-        
-        story.extend(self._create_mission_parameters(config))
-        
-        story.extend(self._create_performance_analysis(simulation_data))
-        
-        story.extend(self._create_trajectory_analysis(simulation_data))
-        
-        story.extend(self._create_technical_details(simulation_data))
-        
-        story.extend(self._create_charts_section(simulation_data))
-        
-        story.extend(self._create_recommendations(simulation_data))
-        
-        doc.build(story)
+
+        stages = [
+            ("report.title_page", lambda: self._create_title_page(simulation_data, config)),
+            ("report.executive_summary", lambda: self._create_executive_summary(simulation_data)),
+            ("report.mission_parameters", lambda: self._create_mission_parameters(config)),
+            ("report.performance_analysis", lambda: self._create_performance_analysis(simulation_data)),
+            ("report.trajectory_analysis", lambda: self._create_trajectory_analysis(simulation_data)),
+            ("report.technical_details", lambda: self._create_technical_details(simulation_data)),
+            ("report.charts", lambda: self._create_charts_section(simulation_data)),
+            ("report.recommendations", lambda: self._create_recommendations(simulation_data)),
+        ]
+        for stage_name, build_stage in stages:
+            with profiler.timed(stage_name):
+                story.extend(build_stage())
+
+        with profiler.timed("report.build_pdf"):
+            doc.build(story)
         return output_path
     
     def _create_title_page(self, simulation_data: Dict, config: Dict) -> List:
@@ -236,18 +297,19 @@ class ReportGenerator:
         elements.append(title)
         elements.append(Spacer(1, 20))
         
-        altitudes = simulation_data.get('altitude', [])
-        velocities = simulation_data.get('velocity', [])
-        times = simulation_data.get('time', [])
-        
-        if altitudes and velocities and times:
-            max_altitude = max(altitudes)
-            max_velocity = max(velocities)
-            burn_time = times[-1] if times else 0
-            
-            max_altitude_time = times[altitudes.index(max_altitude)]
-            max_velocity_time = times[velocities.index(max_velocity)]
-            
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        times = np.asarray(simulation_data.get('time', []), dtype=float)
+        drags = np.asarray(simulation_data.get('drag', [0.0]), dtype=float)
+
+        if altitudes.size and velocities.size and times.size:
+            max_altitude = float(altitudes.max())
+            max_velocity = float(velocities.max())
+            burn_time = float(times[-1])
+
+            max_altitude_time = float(times[np.argmax(altitudes)])
+            max_velocity_time = float(times[np.argmax(velocities)])
+
             trajectory_text = f"""
             Trajectory Characteristics:
             
@@ -264,7 +326,7 @@ class ReportGenerator:
             Atmospheric Effects:
             • Maximum dynamic pressure: {self._calculate_max_q(simulation_data):.2f} Pa
             • Maximum Mach number: {self._calculate_max_mach(simulation_data):.2f}
-            • Maximum drag force: {max(simulation_data.get('drag', [0])):.2f} N
+            • Maximum drag force: {drags.max() if drags.size else 0.0:.2f} N
             """
             
             trajectory = Paragraph(trajectory_text, self.styles['Body'])
@@ -342,83 +404,75 @@ class ReportGenerator:
         return elements
     
     def _generate_charts(self, simulation_data: Dict) -> List[str]:
-        charts = []
-        
-        plt.style.use('dark_background')
-        
-        fig, (ax1, ax2) = plt.subplots(2, 1, figsize=(10, 8))
-        
-        times = simulation_data.get('time', [])
-        altitudes = simulation_data.get('altitude', [])
-        velocities = simulation_data.get('velocity', [])
-        
-        if times and altitudes and velocities:
-            ax1.plot(times, altitudes, 'b-', linewidth=2, label='Altitude')
-            ax1.set_ylabel('Altitude (m)')
-            ax1.set_title('Flight Trajectory')
-            ax1.grid(True, alpha=0.3)
-            ax1.legend()
-            
-            ax2.plot(times, velocities, 'r-', linewidth=2, label='Velocity')
-            ax2.set_xlabel('Time (s)')
-            ax2.set_ylabel('Velocity (m/s)')
-            ax2.grid(True, alpha=0.3)
-            ax2.legend()
-        
-        plt.tight_layout()
-        chart_path = "trajectory_chart.png"
-        plt.savefig(chart_path, dpi=300, bbox_inches='tight')
-        charts.append(chart_path)
-        plt.close()
-        
-        fig, ((ax1, ax2), (ax3, ax4)) = plt.subplots(2, 2, figsize=(12, 8))
-        
-        thrusts = simulation_data.get('thrust', [])
-        isp_values = simulation_data.get('isp_values', [])
-        fuel_remaining = simulation_data.get('fuel_remaining', [])
-        
-        if times and thrusts:
-            ax1.plot(times, thrusts, 'g-', linewidth=2)
-            ax1.set_ylabel('Thrust (N)')
-            ax1.set_title('Thrust Profile')
-            ax1.grid(True, alpha=0.3)
-        
-        if times and isp_values:
-            ax2.plot(times, isp_values, 'y-', linewidth=2)
-            ax2.set_ylabel('Specific Impulse (s)')
-            ax2.set_title('ISP Profile')
-            ax2.grid(True, alpha=0.3)
-        
-        if times and fuel_remaining:
-            ax3.plot(times, fuel_remaining, 'm-', linewidth=2)
-            ax3.set_xlabel('Time (s)')
-            ax3.set_ylabel('Fuel Remaining (kg)')
-            ax3.set_title('Fuel Consumption')
-            ax3.grid(True, alpha=0.3)
-        
-        # TWR plot
-        if times and thrusts and fuel_remaining:
-            twr_values = []
-            for i, thrust in enumerate(thrusts):
-                if i < len(fuel_remaining):
-                    mass = simulation_data.get('intmass', 0) - simulation_data.get('propmass', 0) + fuel_remaining[i]
-                    weight = mass * 9.81
-                    twr = thrust / weight if weight > 0 else 0
-                    twr_values.append(twr)
-            
-            ax4.plot(times[:len(twr_values)], twr_values, 'c-', linewidth=2)
-            ax4.set_xlabel('Time (s)')
-            ax4.set_ylabel('Thrust/Weight Ratio')
-            ax4.set_title('TWR Profile')
-            ax4.grid(True, alpha=0.3)
-        
-        plt.tight_layout()
-        chart_path = "performance_chart.png"
-        plt.savefig(chart_path, dpi=300, bbox_inches='tight')
-        charts.append(chart_path)
-        plt.close()
-        
-        return charts
+        from plot_utils import decimate_envelope
+
+        times = np.asarray(simulation_data.get('time', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        thrusts = np.asarray(simulation_data.get('thrust', []), dtype=float)
+        isp_values = np.asarray(simulation_data.get('isp_values', []), dtype=float)
+        fuel_remaining = np.asarray(simulation_data.get('fuel_remaining', []), dtype=float)
+
+        # Decimate before building specs: the workers receive envelope
+        # series sized to the chart resolution, not raw per-step arrays.
+        specs = []
+
+        if len(times) and len(altitudes) and len(velocities):
+            t_alt, d_alt = decimate_envelope(times, altitudes)
+            t_vel, d_vel = decimate_envelope(times, velocities)
+            specs.append({
+                "path": "trajectory_chart.png",
+                "figsize": (10, 8),
+                "layout": (2, 1),
+                "panels": [
+                    {"x": t_alt, "y": d_alt, "style": 'b-', "label": 'Altitude',
+                     "title": 'Flight Trajectory', "ylabel": 'Altitude (m)'},
+                    {"x": t_vel, "y": d_vel, "style": 'r-', "label": 'Velocity',
+                     "xlabel": 'Time (s)', "ylabel": 'Velocity (m/s)'},
+                ],
+            })
+
+        if len(times) and len(thrusts):
+            panels = []
+            t_thrust, d_thrust = decimate_envelope(times, thrusts)
+            panels.append({"x": t_thrust, "y": d_thrust, "style": 'g-',
+                           "title": 'Thrust Profile', "ylabel": 'Thrust (N)'})
+            if len(isp_values):
+                t_isp, d_isp = decimate_envelope(times, isp_values)
+                panels.append({"x": t_isp, "y": d_isp, "style": 'y-',
+                               "title": 'ISP Profile', "ylabel": 'Specific Impulse (s)'})
+            if len(fuel_remaining):
+                t_fuel, d_fuel = decimate_envelope(times, fuel_remaining)
+                panels.append({"x": t_fuel, "y": d_fuel, "style": 'm-',
+                               "title": 'Fuel Consumption', "xlabel": 'Time (s)',
+                               "ylabel": 'Fuel Remaining (kg)'})
+
+                mass = (simulation_data.get('intmass', 0) - simulation_data.get('propmass', 0)
+                        + fuel_remaining)
+                weight = mass * 9.81
+                twr = np.divide(thrusts, weight, out=np.zeros_like(thrusts), where=weight > 0)
+                t_twr, d_twr = decimate_envelope(times, twr)
+                panels.append({"x": t_twr, "y": d_twr, "style": 'c-',
+                               "title": 'TWR Profile', "xlabel": 'Time (s)',
+                               "ylabel": 'Thrust/Weight Ratio'})
+            specs.append({
+                "path": "performance_chart.png",
+                "figsize": (12, 8),
+                "layout": (2, 2),
+                "panels": panels,
+            })
+
+        if not specs:
+            return []
+
+        if len(specs) > 1:
+            try:
+                from concurrent.futures import ProcessPoolExecutor
+                with ProcessPoolExecutor(max_workers=len(specs)) as pool:
+                    return list(pool.map(_render_chart, specs))
+            except Exception:
+                pass
+        return [_render_chart(spec) for spec in specs]
     
     def _generate_recommendations(self, simulation_data: Dict) -> List[str]:
         recommendations = []
@@ -447,32 +501,28 @@ class ReportGenerator:
         return recommendations
     
     def _calculate_efficiency(self, simulation_data: Dict) -> float:
-        fuel_remaining = simulation_data.get('fuel_remaining', [])
-        if not fuel_remaining:
+        fuel_remaining = np.asarray(simulation_data.get('fuel_remaining', []), dtype=float)
+        if fuel_remaining.size == 0:
             return 0.0
-        
-        initial_fuel = fuel_remaining[0]
-        final_fuel = fuel_remaining[-1]
+
+        initial_fuel = float(fuel_remaining[0])
+        final_fuel = float(fuel_remaining[-1])
         if initial_fuel > 0:
             return ((initial_fuel - final_fuel) / initial_fuel) * 100
         return 0.0
-    
+
     def _calculate_twr_range(self, simulation_data: Dict) -> float:
-        thrusts = simulation_data.get('thrust', [])
-        fuel_remaining = simulation_data.get('fuel_remaining', [])
-        
-        if not thrusts or not fuel_remaining:
+        thrusts = np.asarray(simulation_data.get('thrust', []), dtype=float)
+        fuel_remaining = np.asarray(simulation_data.get('fuel_remaining', []), dtype=float)
+
+        if thrusts.size == 0 or fuel_remaining.size == 0:
             return 0.0
-        
-        twr_values = []
-        for i, thrust in enumerate(thrusts):
-            if i < len(fuel_remaining):
-                mass = simulation_data.get('intmass', 0) - simulation_data.get('propmass', 0) + fuel_remaining[i]
-                weight = mass * 9.81
-                twr = thrust / weight if weight > 0 else 0
-                twr_values.append(twr)
-        
-        return max(twr_values) - min(twr_values) if twr_values else 0.0
+
+        n = min(thrusts.size, fuel_remaining.size)
+        mass = simulation_data.get('intmass', 0) - simulation_data.get('propmass', 0) + fuel_remaining[:n]
+        weight = mass * 9.81
+        twr = np.divide(thrusts[:n], weight, out=np.zeros(n), where=weight > 0)
+        return float(twr.max() - twr.min())
     
     def _calculate_avg_acceleration(self, simulation_data: Dict) -> float:
         velocities = simulation_data.get('velocity', [])
@@ -505,124 +555,107 @@ class ReportGenerator:
         return altitude_score + velocity_score + efficiency_score
     
     def _calculate_max_q(self, simulation_data: Dict) -> float:
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not velocities or not altitudes:
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        max_q = 0
-        for v, h in zip(velocities, altitudes):
-            # Simplified atmospheric density
-            density = 1.225 * np.exp(-h / 8500)
-            q = 0.5 * density * v**2
-            max_q = max(max_q, q)
-        
-        return max_q
-    
+
+        n = min(velocities.size, altitudes.size)
+        # Simplified atmospheric density
+        density = 1.225 * np.exp(-altitudes[:n] / 8500)
+        q = 0.5 * density * velocities[:n]**2
+        return float(q.max())
+
     def _calculate_max_mach(self, simulation_data: Dict) -> float:
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not velocities or not altitudes:
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        max_mach = 0
-        for v, h in zip(velocities, altitudes):
-            # Speed of sound at altitude
-            speed_of_sound = 340 * np.sqrt(get_atmospheric_pressure(h) / 101325)
-            mach = v / speed_of_sound if speed_of_sound > 0 else 0
-            max_mach = max(max_mach, mach)
-        
-        return max_mach
-    
+
+        n = min(velocities.size, altitudes.size)
+        speed_of_sound = get_atmosphere_table().speed_of_sound_batch(altitudes[:n])
+        mach = np.divide(velocities[:n], speed_of_sound, out=np.zeros(n),
+                         where=speed_of_sound > 0)
+        return float(mach.max())
+
     def _calculate_total_impulse(self, simulation_data: Dict) -> float:
-        thrusts = simulation_data.get('thrust', [])
-        times = simulation_data.get('time', [])
-        
-        if not thrusts or not times:
+        thrusts = np.asarray(simulation_data.get('thrust', []), dtype=float)
+        times = np.asarray(simulation_data.get('time', []), dtype=float)
+
+        if thrusts.size < 2 or times.size < 2:
             return 0.0
-        
-        total_impulse = 0
-        for i in range(1, len(thrusts)):
-            dt = times[i] - times[i-1]
-            avg_thrust = (thrusts[i] + thrusts[i-1]) / 2
-            total_impulse += avg_thrust * dt
-        
-        return total_impulse
-    
+
+        n = min(thrusts.size, times.size)
+        dt = np.diff(times[:n])
+        avg_thrust = 0.5 * (thrusts[1:n] + thrusts[:n-1])
+        return float(np.sum(avg_thrust * dt))
+
     def _calculate_thrust_coefficient(self, simulation_data: Dict) -> float:
-        thrusts = simulation_data.get('thrust', [])
-        if not thrusts:
+        thrusts = np.asarray(simulation_data.get('thrust', []), dtype=float)
+        if thrusts.size == 0:
             return 0.0
-        
-        return np.mean(thrusts) / max(thrusts) if max(thrusts) > 0 else 0.0
-    
+
+        peak = float(thrusts.max())
+        return float(thrusts.mean()) / peak if peak > 0 else 0.0
+
     def _calculate_max_cd(self, simulation_data: Dict) -> float:
-        drags = simulation_data.get('drag', [])
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not drags or not velocities or not altitudes:
+        drags = np.asarray(simulation_data.get('drag', []), dtype=float)
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if drags.size == 0 or velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        max_cd = 0
-        for drag, v, h in zip(drags, velocities, altitudes):
-            if v > 0:
-                density = 1.225 * np.exp(-h / 8500)
-                cd = drag / (0.5 * density * v**2 * 1.0)  # Assuming reference area of 1.0
-                max_cd = max(max_cd, cd)
-        
-        return max_cd
-    
+
+        n = min(drags.size, velocities.size, altitudes.size)
+        density = 1.225 * np.exp(-altitudes[:n] / 8500)
+        q = 0.5 * density * velocities[:n]**2 * 1.0  # Assuming reference area of 1.0
+        cd = np.divide(drags[:n], q, out=np.zeros(n), where=velocities[:n] > 0)
+        return float(cd.max())
+
     def _calculate_reynolds_range(self, simulation_data: Dict) -> float:
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not velocities or not altitudes:
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        reynolds_values = []
-        for v, h in zip(velocities, altitudes):
-            density = 1.225 * np.exp(-h / 8500)
-            viscosity = 1.8e-5 * (288.15 / (288.15 - 0.0065 * h))**0.5
-            reynolds = density * v * 1.0 / viscosity
-            reynolds_values.append(reynolds)
-        
-        return max(reynolds_values) - min(reynolds_values) if reynolds_values else 0.0
-    
+
+        n = min(velocities.size, altitudes.size)
+        density = 1.225 * np.exp(-altitudes[:n] / 8500)
+        viscosity = 1.8e-5 * (288.15 / (288.15 - 0.0065 * altitudes[:n]))**0.5
+        reynolds = density * velocities[:n] * 1.0 / viscosity
+        return float(reynolds.max() - reynolds.min())
+
     def _calculate_max_heat_flux(self, simulation_data: Dict) -> float:
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not velocities or not altitudes:
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        max_heat_flux = 0
-        for v, h in zip(velocities, altitudes):
-            if v > 0:
-                density = 1.225 * np.exp(-h / 8500)
-                heat_flux = 0.026 * (v**0.8) * (density**0.2) * (v**2) / 2
-                max_heat_flux = max(max_heat_flux, heat_flux)
-        
-        return max_heat_flux
-    
+
+        n = min(velocities.size, altitudes.size)
+        v = np.clip(velocities[:n], 0.0, None)
+        density = 1.225 * np.exp(-altitudes[:n] / 8500)
+        heat_flux = 0.026 * (v**0.8) * (density**0.2) * (v**2) / 2
+        return float(heat_flux.max())
+
     def _calculate_avg_temp_rise(self, simulation_data: Dict) -> float:
-        velocities = simulation_data.get('velocity', [])
-        altitudes = simulation_data.get('altitude', [])
-        
-        if not velocities or not altitudes:
+        velocities = np.asarray(simulation_data.get('velocity', []), dtype=float)
+        altitudes = np.asarray(simulation_data.get('altitude', []), dtype=float)
+
+        if velocities.size == 0 or altitudes.size == 0:
             return 0.0
-        
-        temp_rises = []
-        for v, h in zip(velocities, altitudes):
-            if v > 0:
-                density = 1.225 * np.exp(-h / 8500)
-                heat_flux = 0.026 * (v**0.8) * (density**0.2) * (v**2) / 2
-                temp_rise = heat_flux * 0.01 / (237 * 2700 * 900)  # Aluminum properties
-                temp_rises.append(temp_rise)
-        
-        return np.mean(temp_rises) if temp_rises else 0.0
+
+        n = min(velocities.size, altitudes.size)
+        moving = velocities[:n] > 0
+        if not moving.any():
+            return 0.0
+        v = velocities[:n][moving]
+        density = 1.225 * np.exp(-altitudes[:n][moving] / 8500)
+        heat_flux = 0.026 * (v**0.8) * (density**0.2) * (v**2) / 2
+        temp_rises = heat_flux * 0.01 / (237 * 2700 * 900)  # Aluminum properties
+        return float(temp_rises.mean())
     
     def _calculate_thermal_efficiency(self, simulation_data: Dict) -> float:
         max_heat_flux = self._calculate_max_heat_flux(simulation_data)
@@ -0,0 +1,98 @@
+import hashlib
+import json
+import os
+
+from result_io import save_results_binary, load_results_binary
+
+
+class ResultCache:
+    """Disk cache of completed simulation results keyed by config hash.
+
+    Keys are the SHA-256 of the sorted simulation parameters (fuel, masses,
+    chamber conditions, dt, max_time, ...), so identical configurations hit
+    the cache instead of re-integrating the flight. Entries are the binary
+    columnar files from result_io stored under the project directory, and
+    least-recently-used entries are evicted past performance.max_cache_size.
+    """
+
+    def __init__(self, cache_dir=os.path.join("projects", ".result_cache"),
+                 enabled=None, max_entries=None):
+        if enabled is None or max_entries is None:
+            try:
+                from config import config as app_config
+                if enabled is None:
+                    enabled = bool(app_config.get("performance.cache_enabled", True))
+                if max_entries is None:
+                    max_entries = int(app_config.get("performance.max_cache_size", 100))
+            except Exception:
+                enabled = True if enabled is None else enabled
+                max_entries = 100 if max_entries is None else max_entries
+
+        self.cache_dir = cache_dir
+        self.enabled = enabled
+        self.max_entries = max_entries
+
+    @staticmethod
+    def config_key(params):
+        payload = json.dumps(params, sort_keys=True, default=str)
+        return hashlib.sha256(payload.encode("utf-8")).hexdigest()
+
+    def _entry_path(self, key):
+        return os.path.join(self.cache_dir, f"{key}.npz")
+
+    def get(self, params):
+        if not self.enabled:
+            return None
+        path = self._entry_path(self.config_key(params))
+        if not os.path.exists(path):
+            return None
+        try:
+            os.utime(path, None)
+            return load_results_binary(path)
+        except Exception:
+            return None
+
+    def put(self, params, results):
+        if not self.enabled or "error" in results:
+            return
+        if not os.path.exists(self.cache_dir):
+            os.makedirs(self.cache_dir)
+        try:
+            save_results_binary(results, self._entry_path(self.config_key(params)))
+        except Exception:
+            return
+        self._evict()
+
+    def _evict(self):
+        try:
+            entries = [
+                os.path.join(self.cache_dir, name)
+                for name in os.listdir(self.cache_dir) if name.endswith(".npz")
+            ]
+            if len(entries) <= self.max_entries:
+                return
+            entries.sort(key=os.path.getmtime)
+            for path in entries[:len(entries) - self.max_entries]:
+                os.remove(path)
+        except OSError:
+            pass
+
+    def clear(self):
+        if not os.path.exists(self.cache_dir):
+            return
+        for name in os.listdir(self.cache_dir):
+            if name.endswith(".npz"):
+                try:
+                    os.remove(os.path.join(self.cache_dir, name))
+                except OSError:
+                    pass
+
+
+_result_cache = None
+
+
+def get_result_cache():
+    global _result_cache
+    if _result_cache is None:
+        _result_cache = ResultCache()
+    return _result_cache
@@ -0,0 +1,113 @@
+import json
+
+import numpy as np
+
+
+class SimulationResult:
+    """Engine output backed by one contiguous (channels, steps) array.
+
+    Every per-step series lives as one row of a single C-contiguous
+    float64 block, so the whole result is one allocation and consumers
+    share it instead of re-converting lists at each layer. Channel
+    access, time slicing and stride decimation all return NumPy views
+    into that block — no copies between engine, GUI and export. The
+    mapping-style interface (result["altitude"], "delta_v" in result,
+    result.get(...)) matches the dict shape the rest of the code already
+    consumes, with non-series payloads (final_time, events, ...) kept as
+    scalars/extras.
+    """
+
+    def __init__(self, channels, data, scalars=None, extras=None):
+        self.channels = tuple(channels)
+        self._index = {name: i for i, name in enumerate(self.channels)}
+        self.data = data
+        self.scalars = dict(scalars or {})
+        self.extras = dict(extras or {})
+
+    @classmethod
+    def from_dict(cls, result):
+        if isinstance(result, cls):
+            return result
+        n = len(result.get("time", ()))
+        channels = []
+        series = []
+        scalars = {}
+        extras = {}
+        for name, value in result.items():
+            if isinstance(value, np.ndarray) and value.ndim == 1 and len(value) == n:
+                channels.append(name)
+                series.append(value)
+            elif (isinstance(value, (list, tuple)) and len(value) == n
+                  and (n == 0 or isinstance(value[0], (int, float, np.floating, np.integer)))):
+                channels.append(name)
+                series.append(value)
+            elif isinstance(value, (bool, int, float, np.floating, np.integer)):
+                scalars[name] = value
+            else:
+                extras[name] = value
+        data = np.empty((len(channels), n), dtype=np.float64)
+        for i, values in enumerate(series):
+            data[i, :] = values
+        return cls(channels, data, scalars, extras)
+
+    @property
+    def steps(self):
+        return self.data.shape[1]
+
+    def channel(self, name):
+        return self.data[self._index[name]]
+
+    def __getitem__(self, name):
+        if name in self._index:
+            return self.data[self._index[name]]
+        if name in self.scalars:
+            return self.scalars[name]
+        return self.extras[name]
+
+    def __contains__(self, name):
+        return name in self._index or name in self.scalars or name in self.extras
+
+    def get(self, name, default=None):
+        return self[name] if name in self else default
+
+    def keys(self):
+        return list(self.channels) + list(self.scalars) + list(self.extras)
+
+    def __bool__(self):
+        return self.steps > 0 or bool(self.scalars)
+
+    def slice(self, start, stop):
+        return SimulationResult(self.channels, self.data[:, start:stop],
+                                self.scalars, self.extras)
+
+    def decimate(self, max_points=2000):
+        if self.steps <= max_points:
+            return self
+        stride = self.steps // max_points
+        return SimulationResult(self.channels, self.data[:, ::stride],
+                                self.scalars, self.extras)
+
+    def to_dict(self):
+        result = {name: self.data[i] for i, name in enumerate(self.channels)}
+        result.update(self.scalars)
+        result.update(self.extras)
+        return result
+
+    def save_npz(self, path, compressed=False):
+        metadata = {"scalars": self.scalars}
+        try:
+            metadata["extras"] = json.loads(json.dumps(self.extras))
+        except (TypeError, ValueError):
+            pass
+        saver = np.savez_compressed if compressed else np.savez
+        saver(path, data=self.data,
+              channels=np.array(self.channels),
+              _metadata=np.array(json.dumps(metadata)))
+
+    @classmethod
+    def load_npz(cls, path):
+        with np.load(path, allow_pickle=False) as archive:
+            data = archive["data"]
+            channels = [str(name) for name in archive["channels"]]
+            metadata = json.loads(str(archive["_metadata"]))
+        return cls(channels, data, metadata.get("scalars", {}), metadata.get("extras", {}))
@@ -0,0 +1,118 @@
+import os
+import threading
+import numpy as np
+
+RECORD_DTYPE = np.dtype([
+    ("time", "f8"),
+    ("thrust", "f8"),
+    ("velocity", "f8"),
+    ("altitude", "f8"),
+    ("drag", "f8"),
+])
+
+
+def _parse_size(text, default=10 * 1024 * 1024):
+    """Parse sizes like the config's "10MB" into bytes."""
+    try:
+        text = str(text).strip().upper()
+        for suffix, factor in (("GB", 1024 ** 3), ("MB", 1024 ** 2), ("KB", 1024)):
+            if text.endswith(suffix):
+                return int(float(text[:-len(suffix)]) * factor)
+        return int(text)
+    except (ValueError, AttributeError):
+        return default
+
+
+class TelemetryRecorder:
+    """Ring buffer of fixed-width binary flight records.
+
+    record() is a single structured-array store — no string formatting and
+    no syscall in the hot loop. A background thread drains the buffer to
+    disk on a fixed interval, appending raw RECORD_DTYPE records, and
+    rotates the file per the logging section of the config
+    (max_file_size/backup_count) when file_rotation is enabled. If the
+    writer laps the flusher, the oldest unflushed records are dropped
+    rather than ever blocking the simulation.
+    """
+
+    def __init__(self, path="telemetry.bin", capacity=8192, flush_interval=0.5):
+        try:
+            from config import config as app_config
+            self.rotation_enabled = bool(app_config.get("logging.file_rotation", True))
+            self.max_file_size = _parse_size(app_config.get("logging.max_file_size", "10MB"))
+            self.backup_count = int(app_config.get("logging.backup_count", 5))
+        except Exception:
+            self.rotation_enabled = True
+            self.max_file_size = 10 * 1024 * 1024
+            self.backup_count = 5
+
+        self.path = path
+        self.capacity = capacity
+        self.flush_interval = flush_interval
+
+        self._buffer = np.zeros(capacity, dtype=RECORD_DTYPE)
+        self._written = 0
+        self._flushed = 0
+        self._lock = threading.Lock()
+        self._stop = threading.Event()
+        self._thread = threading.Thread(target=self._flush_loop, daemon=True)
+        self._thread.start()
+
+    def record(self, time, thrust, velocity, altitude, drag):
+        self._buffer[self._written % self.capacity] = (time, thrust, velocity, altitude, drag)
+        self._written += 1
+
+    def _flush_loop(self):
+        while not self._stop.wait(self.flush_interval):
+            self.flush()
+
+    def flush(self):
+        with self._lock:
+            written = self._written
+            start = max(self._flushed, written - self.capacity)
+            if start >= written:
+                return
+            indices = np.arange(start, written) % self.capacity
+            chunk = self._buffer.take(indices)
+            self._flushed = written
+
+        try:
+            with open(self.path, "ab") as f:
+                f.write(chunk.tobytes())
+            self._maybe_rotate()
+        except OSError:
+            pass
+
+    def _maybe_rotate(self):
+        if not self.rotation_enabled:
+            return
+        try:
+            if os.path.getsize(self.path) < self.max_file_size:
+                return
+            for i in range(self.backup_count - 1, 0, -1):
+                src = f"{self.path}.{i}"
+                if os.path.exists(src):
+                    os.replace(src, f"{self.path}.{i + 1}")
+            os.replace(self.path, f"{self.path}.1")
+        except OSError:
+            pass
+
+    def close(self):
+        self._stop.set()
+        self._thread.join(timeout=2.0)
+        self.flush()
+
+
+def read_telemetry(path):
+    """Load a telemetry file back as a structured record array."""
+    return np.fromfile(path, dtype=RECORD_DTYPE)
+
+
+_recorder = None
+
+
+def get_telemetry():
+    global _recorder
+    if _recorder is None:
+        _recorder = TelemetryRecorder()
+    return _recorder
@@ -0,0 +1,48 @@
+"""Exercise the multiprocessing pool path of Engine.batch_simulate.
+
+Run with:
+    python tests/test_batch_simulate.py
+"""
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
+
+from Engine import BATCH_SUMMARY_CHANNELS, batch_simulate
+
+BASE_CASE = {
+    "fuel_type": "RP1",
+    "cocp": 7000000,
+    "ct": 3500,
+    "altitude": 0,
+    "intmass": 10000,
+    "mfr": 250,
+    "dt": 0.1,
+    "reference_area": 1.0,
+}
+
+
+class BatchSimulatePoolTest(unittest.TestCase):
+    def test_pool_path_fills_shared_summaries(self):
+        # More than one case so batch_simulate takes the shared-memory
+        # pool branch rather than the serial fallback.
+        configs = [dict(BASE_CASE, propmass=propmass)
+                   for propmass in (2000, 4000, 6000)]
+        progress = []
+        results = batch_simulate(configs,
+                                 progress_callback=lambda done, total: progress.append(done))
+
+        for name in BATCH_SUMMARY_CHANNELS:
+            self.assertEqual(len(results[name]), len(configs))
+        self.assertEqual(sorted(progress), list(range(1, len(configs) + 1)))
+        # Longer burns reach higher, so the workers must have written
+        # their rows back through the shared block in case order.
+        self.assertTrue(all(results["max_altitude"][i] < results["max_altitude"][i + 1]
+                            for i in range(len(configs) - 1)))
+        self.assertTrue(all(results["steps"] > 0))
+
+
+if __name__ == "__main__":
+    unittest.main()